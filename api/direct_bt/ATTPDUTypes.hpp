@@ -37,6 +37,7 @@
 
 #include <jau/basic_types.hpp>
 #include <jau/octets.hpp>
+#include <jau/darray.hpp>
 #include <jau/uuid.hpp>
 
 #include "BTTypes0.hpp"
@@ -907,7 +908,7 @@ namespace direct_bt {
             }
 
             AttReadNRsp(const bool blobRsp, const jau::TROOctets & value, jau::nsize_t value_offset=0)
-            : AttPDUMsg(blobRsp ? Opcode::READ_BLOB_RSP : Opcode::READ_RSP, getPDUValueOffset()+value.size()-value_offset),
+            : AttPDUMsg(blobRsp ? Opcode::READ_BLOB_RSP : Opcode::READ_RSP, getPDUValueOffset()+value.size()-std::min(value_offset, value.size())),
               view(pdu, getPDUValueOffset(), getPDUValueSize())
             {
                 if( value_offset > value.size() ) { // Blob: value_size == value_offset -> OK, ends communication
@@ -934,6 +935,122 @@ namespace direct_bt {
             }
     };
 
+    /**
+     * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.7 ATT_READ_MULTIPLE_REQ
+     * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.11 ATT_READ_MULTIPLE_VARIABLE_REQ
+     *
+     * Contains a set of two or more attribute handles.
+     *
+     * Used for
+     * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.4 Read Multiple Characteristic Values
+     * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.5 Read Multiple Variable Length Characteristic Values
+     */
+    class AttReadMultipleReq : public AttPDUMsg
+    {
+        public:
+            AttReadMultipleReq(const uint8_t* source, const jau::nsize_t length)
+            : AttPDUMsg(source, length)
+            {
+                checkOpcode(Opcode::READ_MULTIPLE_REQ, Opcode::READ_MULTIPLE_VARIABLE_REQ);
+            }
+
+            AttReadMultipleReq(const bool variable, const jau::darray<uint16_t>& handles)
+            : AttPDUMsg(variable ? Opcode::READ_MULTIPLE_VARIABLE_REQ : Opcode::READ_MULTIPLE_REQ, 1 + 2*handles.size())
+            {
+                for(jau::nsize_t i=0; i<handles.size(); ++i) {
+                    pdu.put_uint16_nc(1 + 2*i, handles[i]);
+                }
+            }
+
+            /** Returns true if this is an ATT_READ_MULTIPLE_VARIABLE_REQ, otherwise an ATT_READ_MULTIPLE_REQ. */
+            constexpr bool isVariable() const noexcept { return Opcode::READ_MULTIPLE_VARIABLE_REQ == getOpcode(); }
+
+            constexpr_cxx20 jau::nsize_t getHandleCount() const noexcept { return getPDUParamSize() / 2; }
+
+            constexpr uint16_t getHandle(const jau::nsize_t i) const noexcept { return pdu.get_uint16_nc( 1 + 2*i ); }
+
+            constexpr_cxx20 std::string getName() const noexcept override {
+                return "AttReadMultipleReq";
+            }
+
+        protected:
+            std::string valueString() const noexcept override {
+                std::string res = "handles[";
+                for(jau::nsize_t i=0; i<getHandleCount(); ++i) {
+                    if( 0 < i ) {
+                        res.append(", ");
+                    }
+                    res.append(jau::to_hexstring(getHandle(i)));
+                }
+                return res+"]";
+            }
+    };
+
+    /**
+     * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.8 ATT_READ_MULTIPLE_RSP
+     * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.12 ATT_READ_MULTIPLE_VARIABLE_RSP
+     *
+     * ATT_READ_MULTIPLE_RSP contains the concatenated values,
+     * ATT_READ_MULTIPLE_VARIABLE_RSP contains a list of { uint16_t length, uint8_t value[length] } tuples.
+     *
+     * In both cases the set of values is truncated to ATT_MTU-1,
+     * where a truncated tuple keeps its full value length.
+     */
+    class AttReadMultipleRsp : public AttPDUMsg
+    {
+        public:
+            AttReadMultipleRsp(const uint8_t* source, const jau::nsize_t length)
+            : AttPDUMsg(source, length)
+            {
+                checkOpcode(Opcode::READ_MULTIPLE_RSP, Opcode::READ_MULTIPLE_VARIABLE_RSP);
+            }
+
+            /**
+             * Create an empty response with capacity for the given ATT_MTU, see addValue().
+             * @param variable true for ATT_READ_MULTIPLE_VARIABLE_RSP, otherwise ATT_READ_MULTIPLE_RSP
+             * @param mtu the used ATT_MTU
+             */
+            AttReadMultipleRsp(const bool variable, const jau::nsize_t mtu)
+            : AttPDUMsg(variable ? Opcode::READ_MULTIPLE_VARIABLE_RSP : Opcode::READ_MULTIPLE_RSP, mtu)
+            {
+                pdu.resize(1);
+            }
+
+            /** Returns true if this is an ATT_READ_MULTIPLE_VARIABLE_RSP, otherwise an ATT_READ_MULTIPLE_RSP. */
+            constexpr bool isVariable() const noexcept { return Opcode::READ_MULTIPLE_VARIABLE_RSP == getOpcode(); }
+
+            /**
+             * Appends the given value, prefixed by its length if isVariable().
+             *
+             * @param value the attribute value
+             * @return true if the value has been added completely, otherwise false if it has been truncated
+             *         and no further value can be added.
+             */
+            bool addValue(const jau::TROOctets & value) noexcept {
+                const jau::nsize_t offset = pdu.size();
+                const jau::nsize_t space = pdu.capacity() - offset;
+                if( isVariable() ) {
+                    if( space < 2 ) {
+                        return false;
+                    }
+                    const jau::nsize_t value_size = std::min<jau::nsize_t>(space - 2, value.size());
+                    pdu.resize(offset + 2 + value_size);
+                    pdu.put_uint16_nc(offset, static_cast<uint16_t>(value.size()));
+                    pdu.put_bytes_nc(offset + 2, value.get_ptr(), value_size);
+                    return value_size == value.size();
+                } else {
+                    const jau::nsize_t value_size = std::min<jau::nsize_t>(space, value.size());
+                    pdu.resize(offset + value_size);
+                    pdu.put_bytes_nc(offset, value.get_ptr(), value_size);
+                    return value_size == value.size();
+                }
+            }
+
+            constexpr_cxx20 std::string getName() const noexcept override {
+                return "AttReadMultipleRsp";
+            }
+    };
+
     /**
      * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.5.1 ATT_WRITE_REQ
      *
@@ -1255,6 +1372,166 @@ namespace direct_bt {
             }
     };
 
+    /**
+     * Non-owning view of a received ATT_HANDLE_VALUE_NTF or ATT_HANDLE_VALUE_IND, see AttHandleValueRcv.
+     * <p>
+     * Allows the GATT reader to dispatch notifications and indications
+     * straight from its receive buffer w/o copying the PDU and w/o allocation.
+     * </p>
+     * <p>
+     * The view and its value are only valid as long as the underlying receive buffer is not modified,
+     * i.e. for the duration of the listener callbacks.
+     * </p>
+     * @since 2.7.0
+     */
+    class AttHandleValueRcvView
+    {
+        private:
+            constexpr static jau::nsize_t pdu_value_offset = 1 + 2;
+
+            const jau::TROOctets pdu;
+            const jau::TROOctets value;
+
+        public:
+            /** creation timestamp in milliseconds */
+            const uint64_t ts_creation;
+
+            /**
+             * Returns true if the given received PDU is an ATT_HANDLE_VALUE_NTF or ATT_HANDLE_VALUE_IND
+             * of sufficient size to be viewed.
+             */
+            static bool isValid(const uint8_t* source, const jau::nsize_t length) noexcept {
+                if( nullptr == source || pdu_value_offset > length ) {
+                    return false;
+                }
+                const AttPDUMsg::Opcode opc = static_cast<AttPDUMsg::Opcode>(source[0]);
+                return AttPDUMsg::Opcode::HANDLE_VALUE_NTF == opc || AttPDUMsg::Opcode::HANDLE_VALUE_IND == opc;
+            }
+
+            /**
+             * Constructs a view of the given received PDU, which must satisfy isValid().
+             */
+            AttHandleValueRcvView(const uint8_t* source, const jau::nsize_t length) noexcept
+            : pdu(source, length, jau::endian::little),
+              value(source + pdu_value_offset, length - pdu_value_offset, jau::endian::little),
+              ts_creation(jau::getCurrentMilliseconds())
+            { }
+
+            AttHandleValueRcvView(const AttHandleValueRcvView &o) = delete;
+            AttHandleValueRcvView& operator=(const AttHandleValueRcvView &o) = delete;
+
+            constexpr AttPDUMsg::Opcode getOpcode() const noexcept { return static_cast<AttPDUMsg::Opcode>(pdu.get_uint8_nc(0)); }
+
+            constexpr uint16_t getHandle() const noexcept { return pdu.get_uint16_nc(1); }
+
+            /** Returns the value view, still owned by the underlying receive buffer. */
+            jau::TROOctets const & getValue() const noexcept { return value; }
+
+            bool isNotification() const noexcept {
+                return AttPDUMsg::Opcode::HANDLE_VALUE_NTF == getOpcode();
+            }
+
+            bool isIndication() const noexcept {
+                return AttPDUMsg::Opcode::HANDLE_VALUE_IND == getOpcode();
+            }
+
+            std::string toString() const noexcept {
+                return "AttHandleValueRcvView[opcode="+jau::to_hexstring(AttPDUMsg::number(getOpcode()))+" "+AttPDUMsg::getOpcodeString(getOpcode())+
+                       ", handle "+jau::to_hexstring(getHandle())+", size "+std::to_string(value.size())+", data "+value.toString()+"]";
+            }
+    };
+
+    /**
+     * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.4 ATT_MULTIPLE_HANDLE_VALUE_NTF
+     *
+     * Contains a list of { uint16_t handle, uint16_t length, uint8_t value[length] } tuples,
+     * each holding the complete value of a characteristic.
+     *
+     * Used in:
+     * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.10.2 Multiple Variable Length Notifications
+     *
+     * Send by server, only if the client has enabled
+     * Multiple Handle Value Notifications support in its Client Supported Features characteristic,
+     * see GattCharacteristicType::CLIENT_SUPPORTED_FEATURES.
+     */
+    class AttMultipleHandleValueNtf : public AttPDUMsg
+    {
+        public:
+            AttMultipleHandleValueNtf(const uint8_t* source, const jau::nsize_t length)
+            : AttPDUMsg(source, length)
+            {
+                checkOpcode(Opcode::MULTIPLE_HANDLE_VALUE_NTF);
+            }
+
+            /**
+             * Create an empty notification with capacity for the given ATT_MTU, see addHandleValue().
+             * @param mtu the used ATT_MTU
+             */
+            AttMultipleHandleValueNtf(const jau::nsize_t mtu)
+            : AttPDUMsg(Opcode::MULTIPLE_HANDLE_VALUE_NTF, mtu)
+            {
+                pdu.resize(1);
+            }
+
+            /**
+             * Appends the given handle value tuple if it fits completely.
+             *
+             * @param handle the characteristic value handle
+             * @param value the characteristic value
+             * @return true if added, otherwise false if the tuple exceeds the remaining ATT_MTU space
+             */
+            bool addHandleValue(const uint16_t handle, const jau::TROOctets & value) noexcept {
+                const jau::nsize_t offset = pdu.size();
+                if( offset + 2 + 2 + value.size() > pdu.capacity() ) {
+                    return false;
+                }
+                pdu.resize(offset + 2 + 2 + value.size());
+                pdu.put_uint16_nc(offset, handle);
+                pdu.put_uint16_nc(offset + 2, static_cast<uint16_t>(value.size()));
+                pdu.put_bytes_nc(offset + 4, value.get_ptr(), value.size());
+                return true;
+            }
+
+            /**
+             * Retrieves the complete handle value tuple starting at the given PDU offset.
+             *
+             * @param offset PDU offset of the tuple, 1 for the first tuple
+             * @param handle the tuple's characteristic value handle
+             * @param value_size the tuple's value size, its value starts at PDU offset `offset + 4`
+             * @return PDU offset of the next tuple, or zero if no complete tuple starts at the given offset
+             */
+            jau::nsize_t getTuple(const jau::nsize_t offset, uint16_t& handle, jau::nsize_t& value_size) const noexcept {
+                if( 1 > offset || offset + 4 > pdu.size() ) {
+                    return 0;
+                }
+                const jau::nsize_t size = pdu.get_uint16_nc(offset + 2);
+                if( offset + 4 + size > pdu.size() ) {
+                    return 0;
+                }
+                handle = pdu.get_uint16_nc(offset);
+                value_size = size;
+                return offset + 4 + size;
+            }
+
+            /** Returns the number of complete handle value tuples. */
+            jau::nsize_t getTupleCount() const noexcept {
+                jau::nsize_t count = 0;
+                uint16_t handle;
+                jau::nsize_t value_size;
+                for(jau::nsize_t offset = 1; 0 != ( offset = getTuple(offset, handle, value_size) ); ++count) { }
+                return count;
+            }
+
+            std::string getName() const noexcept override {
+                return "AttMultipleHandleValueNtf";
+            }
+
+        protected:
+            std::string valueString() const noexcept override {
+                return "tuples "+std::to_string(getTupleCount())+", size "+std::to_string(getPDUValueSize());
+            }
+    };
+
     /**
      * ATT Protocol PDUs Vol 3, Part F 3.4.7.3
      * <p>
@@ -33,6 +33,7 @@
 
 #include <mutex>
 #include <atomic>
+#include <unordered_map>
 
 #include <jau/darray.hpp>
 #include <jau/cow_darray.hpp>
@@ -424,6 +425,10 @@ namespace direct_bt {
             mutable std::mutex mtx_keys;
             mutable jau::sc_atomic_bool sync_data;
 
+            /** Accumulated L2CAPStats of disconnected devices, guarded by mtx_l2cap_stats */
+            L2CAPStats l2cap_stats_closed;
+            mutable std::mutex mtx_l2cap_stats;
+
             bool updateDataFromHCI() noexcept;
             bool updateDataFromAdapterInfo() noexcept;
             bool initialSetup() noexcept;
@@ -462,19 +467,26 @@ namespace direct_bt {
             friend BTDevice::~BTDevice() noexcept;
 
             friend std::shared_ptr<ConnectionInfo> BTDevice::getConnectionInfo() noexcept;
+            friend void BTDevice::notifyDisconnected() noexcept;
             friend void BTDevice::sendMgmtEvDeviceDisconnected(std::unique_ptr<MgmtEvent> evt) noexcept;
             friend HCIStatusCode BTDevice::disconnect(const HCIStatusCode reason) noexcept;
             friend HCIStatusCode BTDevice::connectLE(uint16_t interval, uint16_t window,
                                                       uint16_t min_interval, uint16_t max_interval,
                                                       uint16_t latency, uint16_t supervision_timeout) noexcept;
             friend HCIStatusCode BTDevice::connectBREDR(const uint16_t pkt_type, const uint16_t clock_offset, const uint8_t role_switch) noexcept;
+            friend void BTDevice::notifyLEFeatures(BTDeviceRef sthis, const LE_Features features) noexcept;
             friend void BTDevice::processL2CAPSetup(BTDeviceRef sthis);
+            friend void BTDevice::submitL2CAPConnected(BTDeviceRef sthis, const BTSecurityLevel sec_level, const bool l2cap_open) noexcept;
+            friend void BTDevice::processL2CAPSetupDone(BTDeviceRef sthis, const BTSecurityLevel sec_level, const bool l2cap_open,
+                                                        std::unique_lock<std::recursive_mutex>& lock_pairing);
             friend bool BTDevice::updatePairingState(BTDeviceRef sthis, const MgmtEvent& evt, const HCIStatusCode evtStatus, SMPPairingState claimed_state) noexcept;
             friend void BTDevice::hciSMPMsgCallback(BTDeviceRef sthis, const SMPPDUMsg& msg, const HCIACLData::l2cap_frame& source) noexcept;
             friend void BTDevice::processDeviceReady(BTDeviceRef sthis, const uint64_t timestamp);
             friend bool BTDevice::connectGATT(std::shared_ptr<BTDevice> sthis) noexcept;
             friend jau::darray<BTGattServiceRef> BTDevice::getGattServices() noexcept;
 
+            void addClosedL2CAPStats(const L2CAPStats& s) noexcept;
+
             bool lockConnect(const BTDevice & device, const bool wait, const SMPIOCapability io_cap) noexcept;
             bool unlockConnect(const BTDevice & device) noexcept;
             bool unlockConnectAny() noexcept;
@@ -508,13 +520,58 @@ namespace direct_bt {
 
             L2CAPServer l2cap_att_srv;
             jau::service_runner l2cap_service;
-            std::unique_ptr<L2CAPClient> l2cap_att;
+            /**
+             * Accepted L2CAP ATT connections keyed by remote address, awaiting their BTDevice via get_l2cap_connection().
+             *
+             * Allows concurrently connecting clients to be handed off in parallel, each waiter only claiming its own connection.
+             * A newer connection from the same remote replaces a still queued one,
+             * which is also dropped if its remote disconnects, see drop_l2cap_connection().
+             */
+            std::unordered_map<BDAddressAndType, std::unique_ptr<L2CAPClient>> l2cap_att_queue;
             std::mutex mtx_l2cap_att;
             std::condition_variable cv_l2cap_att;
             void l2capServerWork(jau::service_runner& sr);
             void l2capServerInit(jau::service_runner& sr);
             void l2capServerEnd(jau::service_runner& sr);
+            void l2capServerQueue(std::unique_ptr<L2CAPClient> l2cap_att_) noexcept;
             std::unique_ptr<L2CAPClient> get_l2cap_connection(std::shared_ptr<BTDevice> device);
+            void drop_l2cap_connection(const BDAddressAndType& addressAndType) noexcept;
+
+            /** Pending L2CAP setup job, either BTDevice::processL2CAPSetup() or its continuation BTDevice::processL2CAPConnected(). */
+            struct L2CAPSetupJob {
+                BTDeviceRef device;
+                /** True for BTDevice::processL2CAPConnected() using sec_level and l2cap_open, otherwise BTDevice::processL2CAPSetup(). */
+                bool connected;
+                BTSecurityLevel sec_level;
+                bool l2cap_open;
+            };
+            /**
+             * Devices pending their local GATT server role L2CAP setup, see BTDevice::processL2CAPSetup(),
+             * as well as the continuation of all L2CAP setups once connected, see BTDevice::processL2CAPConnected().
+             *
+             * Processed by up to L2CAPEnv::L2CAP_ACCEPT_WORKERS worker threads, started on demand
+             * and ending once no job is pending. Hence one slow client's security setup
+             * neither delays the next accept nor the setup of other clients,
+             * while the number of threads stays bounded with many devices connecting.
+             */
+            jau::darray<L2CAPSetupJob> l2cap_setup_queue;
+            jau::nsize_t l2cap_setup_workers;
+            /**
+             * Set by clearL2CAPSetup() on close(), rejecting new jobs and waking up workers waiting in get_l2cap_connection().
+             * Reset by initialize().
+             */
+            jau::sc_atomic_bool l2cap_setup_closing;
+            std::mutex mtx_l2cap_setup;
+            std::condition_variable cv_l2cap_setup;
+            bool submitL2CAPSetup(BTDeviceRef device) noexcept;
+            bool submitL2CAPConnected(BTDeviceRef device, const BTSecurityLevel sec_level, const bool l2cap_open) noexcept;
+            bool submitL2CAPSetupJob(L2CAPSetupJob job) noexcept;
+            void l2capSetupWorker() noexcept;
+            /**
+             * Clears pending L2CAP setup jobs and waits for all workers to end.
+             * If called on a worker itself, e.g. via a user callback, only waits bounded for the other workers.
+             */
+            void clearL2CAPSetup() noexcept;
 
             bool mgmtEvNewSettingsMgmt(const MgmtEvent& e) noexcept;
             void updateAdapterSettings(const bool off_thread, const AdapterSetting new_settings, const bool sendEvent, const uint64_t timestamp) noexcept;
@@ -904,6 +961,27 @@ namespace direct_bt {
              */
             HCIStatusCode setDefaultLE_PHY(const LE_PHYs Tx, const LE_PHYs Rx) noexcept;
 
+            /**
+             * Opens an LE Credit Based Connection-oriented Channel (LE CoC) server on this powered adapter,
+             * listening for remote devices connecting to the given LE SPSM for streaming bulk data.
+             * <p>
+             * Use L2CAPServer::accept() to retrieve each connected L2CAPClient channel,
+             * which inherits the requested receive MTU.
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: 4.22 L2CAP_LE_CREDIT_BASED_CONNECTION_REQ
+             * </p>
+             * @param psm the LE SPSM to listen on, see is_LE_SPSM(),
+             *        or L2CAP_PSM::UNDEFINED to have the kernel allocate a dynamic LE PSM, see L2CAPComm::getBoundPSM()
+             * @param rx_mtu the requested receive MTU (SDU size), zero for the kernel default, otherwise at least L2CAPComm::LE_COC_MIN_MTU
+             * @param io_profile L2CAPIOProfile applied to the server and each accepted channel, defaults to L2CAPIOProfile::BULK
+             * @return the open L2CAPServer owned by the caller, or nullptr on failure
+             * @see BTDevice::openL2CAPChannel()
+             * @since 2.7.0
+             */
+            std::unique_ptr<L2CAPServer> openL2CAPServer(const L2CAP_PSM psm, const uint16_t rx_mtu,
+                                                         const L2CAPIOProfile io_profile=L2CAPIOProfile::BULK) noexcept;
+
             /**
              * Returns a reference to the used singleton BTManager instance, used to create this adapter.
              */
@@ -1148,6 +1226,16 @@ namespace direct_bt {
              */
             jau::darray<BTDeviceRef> getDiscoveredDevices() const noexcept;
 
+            /**
+             * Returns the L2CAPStats of all GATT channels of this adapter,
+             * i.e. the sum of all currently connected devices and of all previous connections.
+             * <p>
+             * Use BTDevice::getL2CAPStats() to find the peers saturating the link or causing reader stalls.
+             * </p>
+             * @since 2.7.0
+             */
+            L2CAPStats getL2CAPStats() const noexcept;
+
             /** Discards all discovered devices. Returns number of removed discovered devices. */
             int removeDiscoveredDevices() noexcept;
 
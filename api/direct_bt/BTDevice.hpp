@@ -98,6 +98,8 @@ namespace direct_bt {
             jau::ordered_atomic<LE_Features, std::memory_order_relaxed> le_features;
             jau::ordered_atomic<LE_PHYs, std::memory_order_relaxed> le_phy_tx;
             jau::ordered_atomic<LE_PHYs, std::memory_order_relaxed> le_phy_rx;
+            jau::relaxed_atomic_uint16 le_tx_octets;
+            jau::ordered_atomic<L2CAPIOProfile, std::memory_order_relaxed> l2cap_io_profile;
             std::shared_ptr<SMPHandler> smpHandler = nullptr;
             std::recursive_mutex mtx_smpHandler;
             std::shared_ptr<BTGattHandler> gattHandler = nullptr;
@@ -180,9 +182,44 @@ namespace direct_bt {
              * Will be performed after connectLE(..), i.e. notifyConnected() and notifyLEFeatures(),
              * initiated by the latter.
              * </p>
+             * <p>
+             * In the local GATT client role, the adapter's single connecting device lock of connectLE(..)
+             * is released before the asynchronous L2CAP connect if no security is required,
+             * otherwise it covers the SMP pairing window until processL2CAPSetupDone().
+             * </p>
+             * <p>
+             * In the local GATT server role, it is performed on one of the adapter's bounded L2CAP setup workers,
+             * claiming the accepted channel and setting its security level,
+             * while its completion continues off-thread via processL2CAPConnected().
+             * </p>
              */
             void processL2CAPSetup(std::shared_ptr<BTDevice> sthis);
 
+            /**
+             * Completes processL2CAPSetup() after the L2CAP channel has been connected or failed to do so,
+             * performing the optional SMP security setup and processDeviceReady() if not encrypted.
+             * <p>
+             * The given lock on mtx_pairing must be held on entry, it may be released before notifying listeners.
+             * </p>
+             */
+            void processL2CAPSetupDone(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open,
+                                       std::unique_lock<std::recursive_mutex>& lock_pairing);
+
+            /**
+             * Off-thread continuation of processL2CAPSetup() after L2CAPClient::openAsync() completed or the accepted channel's setup,
+             * acquiring mtx_pairing and calling processL2CAPSetupDone().
+             * <p>
+             * Performed on one of the adapter's bounded L2CAP setup workers, see submitL2CAPConnected().
+             * </p>
+             */
+            void processL2CAPConnected(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open);
+
+            /**
+             * Schedules processL2CAPConnected() on one of the adapter's bounded L2CAP setup workers,
+             * e.g. from the L2CAPClient::openAsync() completion callback.
+             */
+            void submitL2CAPConnected(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open) noexcept;
+
             /**
              * Established SMP host connection and security for L2CAP connection if sec_level > BTSecurityLevel::NONE.
              * <p>
@@ -223,6 +260,14 @@ namespace direct_bt {
              */
             void processDeviceReady(std::shared_ptr<BTDevice> sthis, const uint64_t timestamp);
 
+            /**
+             * Applies the automatic LE throughput profile if HCIEnv::HCI_LE_THROUGHPUT_AUTO is enabled,
+             * i.e. maximum LE Data Length and LE_PHYs::LE_2M if supported by the remote device.
+             *
+             * The maximum ATT MTU is negotiated by BTGattHandler in either case.
+             */
+            void processLEThroughputProfile() noexcept;
+
             /**
              * Returns a newly established GATT connection.
              * <p>
@@ -413,9 +458,21 @@ namespace direct_bt {
              * Before this method returns, the internal rssi and tx_power will be updated if any changed
              * and therefore all BTAdapterStatusListener's deviceUpdated(..) method called for notification.
              * </p>
+             * <p>
+             * The returned ConnectionInfo also contains the link's LE_PHYs, LE Data Length, used ATT MTU
+             * and the L2CAPStats of the GATT channel.
+             * </p>
              */
             std::shared_ptr<ConnectionInfo> getConnectionInfo() noexcept;
 
+            /**
+             * Returns the L2CAPStats of this device's GATT channel, counted since the current or last connection has been established.
+             * @see ConnectionInfo::getL2CAPStats()
+             * @see BTAdapter::getL2CAPStats()
+             * @since 2.7.0
+             */
+            L2CAPStats getL2CAPStats() const noexcept;
+
             /**
              * Return true if the device has been successfully connected, otherwise false.
              */
@@ -576,6 +633,27 @@ namespace direct_bt {
              */
             HCIStatusCode setConnectedLE_PHY(const LE_PHYs Tx, const LE_PHYs Rx) noexcept;
 
+            /**
+             * Sets the preferred maximum LE Link Layer transmission payload size and time for the given connection.
+             *
+             * - BT Core Spec v5.2: Vol 4, Part E, 7.8.33 LE Set Data Length command
+             *
+             * The maximum of 251 octets allows one ATT PDU of up to 247 bytes per Link Layer packet,
+             * instead of the 27 octets default.
+             *
+             * @param tx_octets preferred maximum number of payload octets, range [27..251]
+             * @param tx_time preferred maximum number of microseconds to transmit a packet, range [328..17040]
+             * @return HCIStatusCode
+             * @see getLETxOctets()
+             */
+            HCIStatusCode setConnectedLE_DataLength(const uint16_t tx_octets, const uint16_t tx_time) noexcept;
+
+            /**
+             * Return the LE Data Length Tx octets accepted via setConnectedLE_DataLength(), zero if unset, i.e. 27 octets default.
+             * @see setConnectedLE_DataLength()
+             */
+            uint16_t getLETxOctets() const noexcept { return le_tx_octets; }
+
             /**
              * Disconnect the LE or BREDR peer's GATT and HCI connection.
              * <p>
@@ -896,6 +974,28 @@ namespace direct_bt {
              */
             bool isConnSecurityAutoEnabled() const noexcept;
 
+            /**
+             * Sets the L2CAPIOProfile of this device's ATT channel, applied on the upcoming connection
+             * and immediately to an already open channel.
+             * <p>
+             * Defaults to L2CAPIOProfile::DEFAULT, i.e. the kernel defaults.
+             * L2CAPIOProfile::LOW_LATENCY lets interactive GATT traffic pass bulk transfers on the same adapter,
+             * e.g. LE CoC channels opened via openL2CAPChannel().
+             * </p>
+             * @param io_profile the L2CAPIOProfile to be applied
+             * @return true if stored and applied to an open channel, otherwise false
+             * @see getConnIOProfile()
+             * @since 2.7.0
+             */
+            bool setConnIOProfile(const L2CAPIOProfile io_profile) noexcept;
+
+            /**
+             * Returns the L2CAPIOProfile of this device's ATT channel.
+             * @see setConnIOProfile()
+             * @since 2.7.0
+             */
+            L2CAPIOProfile getConnIOProfile() const noexcept { return l2cap_io_profile; }
+
             /**
              * Method sets the given passkey entry, see ::PairingMode::PASSKEY_ENTRY_ini.
              * <p>
@@ -1028,6 +1128,32 @@ namespace direct_bt {
              */
             void remove() noexcept;
 
+            /**
+             * Opens an LE Credit Based Connection-oriented Channel (LE CoC) to this connected LE device
+             * for streaming bulk data without the ATT protocol overhead and its one request at a time semantics.
+             * <p>
+             * Each L2CAPClient::write() is sent as one SDU of up to L2CAPClient::getTxMTU() octets
+             * and each L2CAPClient::read() returns one SDU of up to L2CAPComm::getRxMTU() octets.
+             * The kernel performs the segmentation into MPS sized PDUs and the credit based flow control.
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: 4.22 L2CAP_LE_CREDIT_BASED_CONNECTION_REQ
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: 10.1 LE Credit Based Flow Control Mode
+             * </p>
+             * @param psm the remote's LE SPSM, see is_LE_SPSM()
+             * @param rx_mtu the requested receive MTU (SDU size), zero for the kernel default, otherwise at least L2CAPComm::LE_COC_MIN_MTU
+             * @param sec_level sec_level < BTSecurityLevel::NONE will not set security level
+             * @param io_profile L2CAPIOProfile applied to the channel, defaults to L2CAPIOProfile::BULK
+             * @return the connected L2CAPClient channel owned by the caller, or nullptr on failure
+             * @see BTAdapter::openL2CAPServer()
+             * @since 2.7.0
+             */
+            std::unique_ptr<L2CAPClient> openL2CAPChannel(const L2CAP_PSM psm, const uint16_t rx_mtu,
+                                                          const BTSecurityLevel sec_level=BTSecurityLevel::NONE,
+                                                          const L2CAPIOProfile io_profile=L2CAPIOProfile::BULK) noexcept;
+
             /**
              * Returns the connected GATTHandler or nullptr, see connectGATT(), getGattServices() and disconnect().
              *
@@ -1136,6 +1262,9 @@ namespace direct_bt {
              *
              * Implementation awaits the indication reply after sending out the indication.
              *
+             * Shall not be called from a DBGattServer::Listener callback, running on the GATT reader thread
+             * processing the confirmation. If done so, the indication is only queued, see BTGattHandler::sendIndication().
+             *
              * @param char_value_handle valid characteristic value handle, must be sourced from referenced DBGattServer
              * @param value the octets to be send
              * @return true if successful, otherwise false
@@ -35,6 +35,7 @@
 #include <atomic>
 
 #include <jau/java_uplink.hpp>
+#include <jau/ordered_atomic.hpp>
 #include <jau/octets.hpp>
 #include <jau/uuid.hpp>
 
@@ -113,6 +114,28 @@ namespace direct_bt {
                 ExtProps        = (1 << 7)
             };
 
+            /**
+             * Statistics of one streaming write without response,
+             * see writeValueNoRespStream() and BTGattHandler::writeCharacteristicValueNoRespStream().
+             */
+            struct StreamWriteStats {
+                /** Number of written value bytes */
+                jau::nsize_t bytes = 0;
+                /** Number of sent ATT_WRITE_CMD PDUs */
+                jau::nsize_t pdu_count = 0;
+                /** Number of times the sender waited for the L2CAP send queue to drain */
+                jau::nsize_t stall_count = 0;
+                /** Total duration in milliseconds */
+                uint64_t duration_ms = 0;
+
+                /** Returns the sustained throughput in value bytes per second. */
+                double getThroughput() const noexcept {
+                    return 0 < duration_ms ? ( static_cast<double>(bytes) * 1000.0 ) / static_cast<double>(duration_ms) : 0.0;
+                }
+
+                std::string toString() const noexcept;
+            };
+
             /**
              * Characteristic Handle of this instance.
              * <p>
@@ -144,6 +167,16 @@ namespace direct_bt {
             /* Optional Characteristic User Description index within descriptorList */
             int userDescriptionIndex = -1;
 
+            /**
+             * True if descriptorList has been discovered completely, see ensureDescriptorsDiscovered().
+             *
+             * Set by BTGattHandler under its command mutex only after descriptorList has been completed,
+             * hence its sequentially consistent load lets lock-free readers safely access descriptorList.
+             * Once set, descriptorList is not modified anymore.
+             * Remains false if the descriptor handle range could not be enumerated completely, allowing a later retry.
+             */
+            jau::sc_atomic_bool descriptorsDiscovered { false };
+
             BTGattChar(const BTGattServiceRef & service_, const uint16_t handle_,
                        const PropertyBitVal properties_, const uint16_t value_handle_, std::unique_ptr<const jau::uuid_t> && value_type_) noexcept
             : wbr_service(service_), handle(handle_),
@@ -165,6 +198,8 @@ namespace direct_bt {
             /**
              * Find a BTGattDesc by its desc_uuid.
              *
+             * Descriptors are discovered on demand via ensureDescriptorsDiscovered().
+             *
              * @parameter desc_uuid the UUID of the desired BTGattDesc
              * @return The matching descriptor or null if not found
              */
@@ -172,20 +207,41 @@ namespace direct_bt {
 
             std::string toString() const noexcept override;
 
+            /**
+             * Clears the descriptorList and resets descriptorsDiscovered.
+             *
+             * Must not be called while descriptorList may be accessed concurrently.
+             */
             void clearDescriptors() noexcept {
+                descriptorsDiscovered = false; // first, invalidating descriptorList
                 descriptorList.clear();
                 clientCharConfigIndex = -1;
                 userDescriptionIndex = -1;
             }
 
+            /**
+             * Ensures this characteristic's descriptorList has been discovered.
+             *
+             * Descriptors are discovered eagerly by BTGattHandler::initClientGatt(),
+             * unless BTGattEnv::GATT_LAZY_DESCRIPTOR_DISCOVERY is enabled.
+             * In the latter case, they are discovered with the first call of this method,
+             * also used by all descriptor accessors and configNotificationIndication().
+             *
+             * If the BTDevice's BTGattHandler is null, i.e. not connected, false is returned.
+             *
+             * @return true if descriptorList has been discovered, otherwise false
+             * @see BTGattHandler::discoverDescriptors(BTGattChar&)
+             */
+            bool ensureDescriptorsDiscovered() noexcept;
+
             /**
              * Return the Client Characteristic Configuration BTGattDescRef if available or nullptr.
              *
              * The BTGattDesc::Type::CLIENT_CHARACTERISTIC_CONFIGURATION has been indexed while
-             * retrieving the GATT database from the server.
+             * retrieving the GATT database from the server, see ensureDescriptorsDiscovered().
              */
-            BTGattDescRef getClientCharConfig() const noexcept {
-                if( 0 > clientCharConfigIndex ) {
+            BTGattDescRef getClientCharConfig() noexcept {
+                if( !ensureDescriptorsDiscovered() || 0 > clientCharConfigIndex ) {
                     return nullptr;
                 }
                 return descriptorList.at(static_cast<size_t>(clientCharConfigIndex)); // abort if out of bounds
@@ -195,9 +251,19 @@ namespace direct_bt {
              * Return the User Description BTGattDescRef if available or nullptr.
              *
              * The BTGattDesc::Type::CHARACTERISTIC_USER_DESCRIPTION has been indexed while
-             * retrieving the GATT database from the server.
+             * retrieving the GATT database from the server, see ensureDescriptorsDiscovered().
+             */
+            BTGattDescRef getUserDescription() noexcept {
+                if( !ensureDescriptorsDiscovered() ) {
+                    return nullptr;
+                }
+                return getUserDescriptionUnchecked();
+            }
+
+            /**
+             * Return the User Description BTGattDescRef if already discovered and available, otherwise nullptr.
              */
-            BTGattDescRef getUserDescription() const noexcept {
+            BTGattDescRef getUserDescriptionUnchecked() const noexcept {
                 if( 0 > userDescriptionIndex ) {
                     return nullptr;
                 }
@@ -402,6 +468,22 @@ namespace direct_bt {
              * </p>
              */
             bool writeValueNoResp(const jau::TROOctets & value) noexcept;
+
+            /**
+             * BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.1 Write Characteristic Value Without Response
+             * <p>
+             * Flow controlled streaming of large values, see BTGattHandler::writeCharacteristicValueNoRespStream().
+             * </p>
+             * <p>
+             * Convenience delegation call to BTGattHandler via BTDevice
+             * <p>
+             * </p>
+             * If the BTDevice's BTGattHandler is null, i.e. not connected, false is returned.
+             * </p>
+             * @param value the complete value to be streamed
+             * @param stats optional StreamWriteStats receiving the transfer statistics, may be nullptr
+             */
+            bool writeValueNoRespStream(const jau::TROOctets & value, StreamWriteStats * stats=nullptr) noexcept;
     };
     typedef std::shared_ptr<BTGattChar> BTGattCharRef;
 
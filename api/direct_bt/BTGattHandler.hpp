@@ -32,6 +32,7 @@
 #include <cstdint>
 
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 #include <thread>
 
@@ -40,6 +41,7 @@
 #include <jau/cow_darray.hpp>
 #include <jau/uuid.hpp>
 #include <jau/service_runner.hpp>
+#include <jau/function_def.hpp>
 
 #include "BTTypes0.hpp"
 #include "L2CAPComm.hpp"
@@ -119,6 +121,39 @@ namespace direct_bt {
              */
             const int32_t ATTPDU_RING_CAPACITY;
 
+            /**
+             * Lazy descriptor discovery, defaults to false.
+             * <p>
+             * If true, initClientGatt() only discovers services and characteristics.
+             * A characteristic's descriptors are discovered on demand, see BTGattChar::ensureDescriptorsDiscovered().
+             * </p>
+             * <p>
+             * Environment variable is 'direct_bt.gatt.discovery.lazy'.
+             * </p>
+             */
+            const bool GATT_LAZY_DESCRIPTOR_DISCOVERY;
+
+            /**
+             * Capacity of the per connection indication queue used in GATTRole::Server, defaults to 32 indications.
+             * <p>
+             * Environment variable is 'direct_bt.gatt.indication.queue'.
+             * </p>
+             * @see BTGattHandler::sendIndicationAsync()
+             */
+            const int32_t GATT_INDICATION_QUEUE_CAPACITY;
+
+            /**
+             * Capacity of the per connection write command queue of a pipelined DBGattServer::Mode::FWD proxy, defaults to 64 commands.
+             * <p>
+             * The client's reader thread blocks once the queue is full, i.e. the queue applies backpressure.
+             * </p>
+             * <p>
+             * Environment variable is 'direct_bt.gatt.fwd.writecmd.queue'.
+             * </p>
+             * @see DBGattServer::isFwdPipelined()
+             */
+            const int32_t GATT_FWD_WRITE_CMD_QUEUE_CAPACITY;
+
             /**
              * Debug all GATT Data communication
              * <p>
@@ -228,6 +263,17 @@ namespace direct_bt {
                      */
                     virtual bool replyReadReq(const AttPDUMsg * pdu) noexcept = 0;
 
+                    /**
+                     * Reply to a read multiple request
+                     * - BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.7 ATT_READ_MULTIPLE_REQ
+                     * - BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.11 ATT_READ_MULTIPLE_VARIABLE_REQ
+                     * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.4 Read Multiple Characteristic Values
+                     * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.5 Read Multiple Variable Length Characteristic Values
+                     * @param pdu
+                     * @return true if transmission was successful, otherwise false
+                     */
+                    virtual bool replyReadMultipleReq(const AttReadMultipleReq * pdu) noexcept = 0;
+
                     /**
                      * Reply to a write request.
                      *
@@ -290,6 +336,58 @@ namespace direct_bt {
                      * @return true if transmission was successful, otherwise false
                      */
                     virtual bool replyReadByGroupTypeReq(const AttReadByNTypeReq * pdu) noexcept = 0;
+
+                    /**
+                     * Returns the Client Characteristic Configuration bits as written by this connection's client
+                     * for the given characteristic value handle, zero if unset or not supported.
+                     *
+                     * - bit 0: notification enabled
+                     * - bit 1: indication enabled
+                     *
+                     * - BT Core Spec v5.2: Vol 3, Part G GATT: 3.3.3.3 Client Characteristic Configuration
+                     *
+                     * @param char_value_handle characteristic value handle
+                     */
+                    virtual uint8_t getClientCharConfig(const uint16_t char_value_handle) noexcept {
+                        (void)char_value_handle;
+                        return 0;
+                    }
+
+                    /**
+                     * Returns true if this connection's client has enabled Multiple Handle Value Notifications
+                     * in its Client Supported Features characteristic, otherwise false.
+                     *
+                     * - BT Core Spec v5.2: Vol 3, Part G GATT: 7.2 Client Supported Features
+                     */
+                    virtual bool isMultipleHandleValueNtfSupported() noexcept { return false; }
+            };
+
+            /**
+             * Indication completion callback, see sendIndicationAsync().
+             *
+             * Invoked with the characteristic value handle and `true` if the client has confirmed the indication,
+             * otherwise `false` on confirmation timeout, transmission error or disconnect.
+             *
+             * Invoked on the GATT reader thread or the sending thread, hence shall return as soon as possible.
+             */
+            typedef jau::FunctionDef<void, const uint16_t /* char_value_handle */, const bool /* confirmed */> IndicationCallback;
+
+            /**
+             * Indication queue metrics, see getIndicationStats().
+             */
+            struct IndicationStats {
+                /** Current queue depth, including the indication awaiting its confirmation. */
+                jau::nsize_t depth = 0;
+                /** Maximum queue depth seen. */
+                jau::nsize_t max_depth = 0;
+                /** Number of confirmed indications. */
+                uint64_t confirmed = 0;
+                /** Number of failed indications, i.e. confirmation timeout, transmission error or disconnect. */
+                uint64_t failed = 0;
+                /** Last round-trip time in milliseconds from sending the indication until receiving its confirmation. */
+                uint64_t last_rtt_ms = 0;
+
+                std::string toString() const noexcept;
             };
 
             /**
@@ -310,6 +408,8 @@ namespace direct_bt {
 
                     /**
                      * Called from native BLE stack, initiated by a received notification.
+                     *
+                     * Each handle value tuple of a received ATT_MULTIPLE_HANDLE_VALUE_NTF is passed as a separate notification.
                      * @param source BTDevice origin of this notification
                      * @param charHandle the GATT characteristic handle related to this notification
                      * @param charValue the notification value
@@ -457,6 +557,8 @@ namespace direct_bt {
             jau::relaxed_atomic_bool has_ioerror;  // reflects state
 
             jau::service_runner l2cap_reader_service;
+            /** Thread id of l2cap_reader_service, running all received PDU processing and server listener callbacks */
+            std::atomic<std::thread::id> l2cap_reader_id { std::thread::id() };
             jau::ringbuffer<std::unique_ptr<const AttPDUMsg>, jau::nsize_t> attPDURing;
 
             jau::relaxed_atomic_uint16 serverMTU; // set in initClientGatt()
@@ -466,6 +568,29 @@ namespace direct_bt {
             /** send immediate confirmation of indication events from device, defaults to true. */
             jau::relaxed_atomic_bool sendIndicationConfirmation = true;
 
+            struct PendingIndication {
+                std::shared_ptr<const AttHandleValueRcv> pdu;
+                IndicationCallback callback;
+                /** Time of transmission, zero if not yet sent */
+                uint64_t ts_sent;
+            };
+            /** GATTRole::Server indication queue, the head awaits its confirmation if sent. */
+            std::recursive_mutex mtx_indications;
+            jau::darray<PendingIndication> indicationQueue;
+            IndicationStats indicationStats;
+
+            /** Sends the queue head non-blocking via sendQueued() if not yet sent, dropping failed ones into `done`. Requires mtx_indications. */
+            void sendNextIndicationLocked(jau::darray<PendingIndication>& done) noexcept;
+            /** Completes the sent queue head, if any, and sends the next one. */
+            bool completeIndication(const bool confirmed) noexcept;
+            /**
+             * Fails the sent queue head if its confirmation timed out.
+             * @return remaining milliseconds until the sent queue head times out, or zero if none is pending
+             */
+            int32_t checkIndicationTimeout() noexcept;
+            /** Fails all queued indications, used on disconnect. */
+            void flushIndications() noexcept;
+
             struct GattCharListenerPair {
                 /** The actual listener */
                 BTGattCharListenerRef listener;
@@ -507,11 +632,37 @@ namespace direct_bt {
              */
             bool replyAttPDUReq(std::unique_ptr<const AttPDUMsg> && pdu) noexcept;
 
+            /** Dispatches a received notification to all NativeGattCharListener and matching BTGattCharListener, on the reader thread. */
+            void dispatchNotification(const uint16_t handle, const jau::TROOctets& value, const uint64_t timestamp) noexcept;
+
+            void l2capReaderInit(jau::service_runner& sr) noexcept;
             void l2capReaderWork(jau::service_runner& sr) noexcept;
             void l2capReaderEndLocked(jau::service_runner& sr) noexcept;
 
             bool l2capReaderInterrupted(int dummy=0) /* const */ noexcept;
 
+            /**
+             * Writes the given PDU header and payload via a single l2cap write,
+             * disconnect() and returns false if an unexpected l2cap write errors occurs.
+             *
+             * @param msg the originating AttPDUMsg for logging, may be nullptr
+             * @param queued if true, uses the non-blocking L2CAPClient::writeQueued() and returns false w/o disconnect() on its backpressure
+             */
+            bool l2capWrite(const uint8_t* header, const jau::nsize_t header_size,
+                            const uint8_t* payload, const jau::nsize_t payload_size, const AttPDUMsg* msg,
+                            const bool queued=false) noexcept;
+
+            /**
+             * Non-blocking send() variant via L2CAPClient::writeQueued(),
+             * used by the l2cap reader thread to not stall on a slow peer, e.g. sending an indication confirmation.
+             *
+             * @param msg the message to be send
+             * @return true if sent or queued, otherwise false if write error, not connected, message size exceeds usedMTU-1 or if the send queue is full.
+             */
+            bool sendQueued(const AttPDUMsg & msg) noexcept;
+
+            bool sendNotificationImpl(const uint16_t char_value_handle, const jau::TROOctets & value, const bool queued) noexcept;
+
             /**
              * BT Core Spec v5.2: Vol 3, Part G GATT: 3.4.2 MTU Exchange
              *
@@ -554,6 +705,23 @@ namespace direct_bt {
              */
             bool discoverDescriptors(BTGattServiceRef & service) noexcept;
 
+            /**
+             * Discover all descriptors of the given characteristic range within a service,
+             * sweeping their handle range with one ATT_FIND_INFORMATION_REQ sequence.
+             *
+             * A descriptor failing to be read is kept with an empty value, not aborting the sweep.
+             * Each characteristic's descriptorList is built aside and published at once
+             * for characteristics whose descriptor handle range has been completely enumerated,
+             * others remain subject to a later discovery.
+             * An already discovered characteristic's descriptorList is never modified.
+             *
+             * @param service the service owning the characteristics
+             * @param charBegin index of the first characteristic within BTGattService::characteristicList
+             * @param charEnd index after the last characteristic within BTGattService::characteristicList
+             * @return true if the sweep has been completed, otherwise false if no reply has been received
+             */
+            bool discoverDescriptors(BTGattServiceRef & service, const int charBegin, const int charEnd) noexcept;
+
             /**
              * Discover all primary services _and_ all its characteristics declarations
              * including their client config.
@@ -564,6 +732,11 @@ namespace direct_bt {
              *
              * Service discovery may consume 500ms - 2000ms, depending on bandwidth.
              *
+             * Discovery runs sequentially on the single unenhanced ATT bearer, L2CAP_CID::ATT,
+             * as ATT permits one outstanding request per bearer.
+             * Parallel discovery across Enhanced ATT (EATT) bearers is not supported,
+             * see discoverDescriptors(BTGattServiceRef&, const int, const int) for the reduced round trips instead.
+             *
              * Method called from initClientGatt().
              *
              * @param shared_this shared pointer of this instance, used to forward a weak_ptr to BTGattService for back-reference. Reference is validated.
@@ -639,7 +812,8 @@ namespace direct_bt {
             /**
              * Initialize the connection and internal data set for GATT client operations:
              * - Exchange MTU
-             * - Discover all primary services, its characteristics and its descriptors
+             * - Discover all primary services, its characteristics and its descriptors,
+             *   the latter skipped if BTGattEnv::GATT_LAZY_DESCRIPTOR_DISCOVERY is enabled
              * - Extracts the GattGenericAccessSvc from the services, see getGenericAccess()
              *
              * Service discovery may consume 500ms - 2000ms, depending on bandwidth.
@@ -652,6 +826,18 @@ namespace direct_bt {
              */
             bool initClientGatt(std::shared_ptr<BTGattHandler> shared_this, bool& already_init) noexcept;
 
+            /**
+             * Discover all descriptors of the given characteristic _only_, if not yet discovered.
+             * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.7.1 Discover All Characteristic Descriptors
+             *
+             * Used for on demand discovery if BTGattEnv::GATT_LAZY_DESCRIPTOR_DISCOVERY is enabled.
+             *
+             * @param charDecl the characteristic, owned by one of this instance's services
+             * @return true if the descriptors have been discovered, now or earlier, otherwise false
+             * @see BTGattChar::ensureDescriptorsDiscovered()
+             */
+            bool discoverDescriptors(BTGattChar & charDecl) noexcept;
+
             /**
              * Returns a reference of the internal kept BTGattService list.
              *
@@ -685,6 +871,27 @@ namespace direct_bt {
              */
             bool send(const AttPDUMsg & msg) noexcept;
 
+            /**
+             * Sends the given ATT PDU header and value payload as one PDU to the connected device
+             * via a single l2cap scatter-gather write, see L2CAPClient::writev().
+             *
+             * The value is not copied into an intermediate AttPDUMsg,
+             * allowing to share one immutable value buffer across all read responses and notifications,
+             * see DBGattValueRef.
+             *
+             * Implementation is thread safe and disconnect() and returns false if an unexpected l2cap write errors occurs.
+             *
+             * @param header the ATT PDU header, i.e. opcode and opcode specific parameter before the value
+             * @param header_size size of the header in bytes, at least 1 for the opcode
+             * @param value the value payload, may be nullptr if value_size is zero
+             * @param value_size size of the value in bytes
+             * @param queued if true, uses the non-blocking L2CAPClient::writeQueued(), see sendQueued()
+             * @return true if successful otherwise false if write error, not connected, if the PDU size exceeds usedMTU
+             *         or if queued and the send queue is full.
+             */
+            bool sendScattered(const uint8_t* header, const jau::nsize_t header_size,
+                               const uint8_t* value, const jau::nsize_t value_size, const bool queued=false) noexcept;
+
             /**
              * Sends the given AttPDUMsg to the connected device via l2cap using {@link #send()}.
              *
@@ -759,9 +966,30 @@ namespace direct_bt {
 
             /**
              * Generic write GATT value and long value
+             * <p>
+             * If withResponse is true and the value exceeds `usedMTU - 3`, writeValueLong() is used.
+             * </p>
              */
             bool writeValue(const uint16_t handle, const jau::TROOctets & value, const bool withResponse) noexcept;
 
+            /**
+             * Write long GATT value using reliable writes.
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.4 Write Long Characteristic Values
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.5 Reliable Writes
+             * </p>
+             * <p>
+             * The value is split into ATT_PREPARE_WRITE_REQ chunks of `usedMTU - 5` bytes.
+             * Each echoed ATT_PREPARE_WRITE_RSP is verified against its request.
+             * A single ATT_EXECUTE_WRITE_REQ writes all prepared chunks at once if verified,
+             * otherwise cancels them, i.e. on a missing, erroneous or mismatching ATT_PREPARE_WRITE_RSP.
+             * </p>
+             * @return true if all chunks were verified and executed, otherwise false
+             */
+            bool writeValueLong(const uint16_t handle, const jau::TROOctets & value) noexcept;
+
             /**
              * BT Core Spec v5.2: Vol 3, Part G GATT: 4.12.3 Write Characteristic Descriptors
              * <p>
@@ -783,6 +1011,28 @@ namespace direct_bt {
              */
             bool writeCharacteristicValueNoResp(const BTGattChar & c, const jau::TROOctets & value) noexcept;
 
+            /**
+             * BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.1 Write Characteristic Value Without Response
+             * <p>
+             * Flow controlled streaming variant of writeCharacteristicValueNoResp() for large values, e.g. firmware uploads.
+             * </p>
+             * <p>
+             * The given value is split into chunks of `usedMTU - 3` bytes, each sent as one ATT_WRITE_CMD.
+             * Before sending a chunk, the L2CAP send queue space is queried via L2CAPClient::getTxQueueSpace().
+             * If the remaining space can't hold the chunk, the sender waits via L2CAPClient::waitWritable()
+             * until the controller has consumed queued ACL packets, i.e. returned its ACL buffer credits.
+             * This keeps the send queue filled without overflowing it.
+             * </p>
+             * <p>
+             * Method locks the command mutex for the whole duration, i.e. the stream is not interleaved with other commands.
+             * </p>
+             * @param c the characteristic to write to
+             * @param value the complete value to be streamed
+             * @param stats optional BTGattChar::StreamWriteStats receiving the transfer statistics, may be nullptr
+             * @return true if the complete value has been sent, otherwise false
+             */
+            bool writeCharacteristicValueNoRespStream(const BTGattChar & c, const jau::TROOctets & value, BTGattChar::StreamWriteStats * stats=nullptr) noexcept;
+
             /**
              * BT Core Spec v5.2: Vol 3, Part G GATT: 3.3.3.3 Client Characteristic Configuration
              * <p>
@@ -811,6 +1061,33 @@ namespace direct_bt {
              */
             bool sendNotification(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept;
 
+            /**
+             * Non-blocking sendNotification() variant via L2CAPClient::writeQueued(),
+             * not stalling the calling thread on a slow client, e.g. when forwarding from another BTGattHandler's reader thread.
+             *
+             * This command is only valid if this BTGattHandler is in role GATTRole::Server.
+             *
+             * @param char_value_handle valid characteristic value handle, must be sourced from referenced DBGattServer
+             * @return true if sent or queued, otherwise false, including the send queue being full
+             * @since 2.7.0
+             */
+            bool sendNotificationAsync(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept;
+
+            /**
+             * Send the given multiple handle value notification to the connected BTRole::Master.
+             *
+             * This command is only valid if this BTGattHandler is in role GATTRole::Server
+             * and the client supports it, see isMultipleHandleValueNtfSupported().
+             *
+             * Implementation is not receiving any reply after sending out the notification and returns immediately.
+             *
+             * - BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.4 ATT_MULTIPLE_HANDLE_VALUE_NTF
+             *
+             * @param ntf the notification holding the characteristic value handle and value tuples, must not exceed getUsedMTU()
+             * @return true if successful, otherwise false
+             */
+            bool sendMultipleNotification(const AttMultipleHandleValueNtf & ntf) noexcept;
+
             /**
              * Send an indication event consisting out of the given `value` representing the given characteristic value handle
              * to the connected BTRole::Master.
@@ -819,11 +1096,81 @@ namespace direct_bt {
              *
              * Implementation awaits the indication reply after sending out the indication.
              *
+             * The indication is passed through the indication queue, see sendIndicationAsync(),
+             * hence notifications may be sent concurrently while awaiting the confirmation.
+             *
+             * The confirmation is processed by this instance's reader thread,
+             * which also runs all DBGattServer::Listener callbacks.
+             * Hence this method shall not be called from a DBGattServer::Listener callback;
+             * if done so, the indication is only queued without awaiting its confirmation, see sendIndicationAsync().
+             *
              * @param char_value_handle valid characteristic value handle, must be sourced from referenced DBGattServer
-             * @return true if successful, otherwise false
+             * @return true if successful, otherwise false. If called on the reader thread, true if queued.
              */
             bool sendIndication(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept;
 
+            /**
+             * Queue an indication event consisting out of the given `value` representing the given characteristic value handle
+             * to the connected BTRole::Master without blocking.
+             *
+             * This command is only valid if this BTGattHandler is in role GATTRole::Server.
+             *
+             * Only one indication may be outstanding per ATT bearer,
+             * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.2 ATT_HANDLE_VALUE_IND.
+             * Queued indications are sent one after another, as soon as the previous confirmation has been received.
+             * Notifications are not blocked while awaiting a confirmation.
+             *
+             * An unconfirmed indication fails after the write command reply timeout.
+             *
+             * The queue capacity is given by BTGattEnv::GATT_INDICATION_QUEUE_CAPACITY.
+             *
+             * @param char_value_handle valid characteristic value handle, must be sourced from referenced DBGattServer
+             * @param value the value to indicate, truncated to ATT_MTU-3
+             * @param callback optional IndicationCallback invoked on completion
+             * @return true if queued, otherwise false if invalid or the queue is full, where the callback is not invoked.
+             * @see getIndicationStats()
+             */
+            bool sendIndicationAsync(const uint16_t char_value_handle, const jau::TROOctets & value,
+                                     const IndicationCallback& callback = IndicationCallback()) noexcept;
+
+            /**
+             * Returns a snapshot of the indication queue metrics.
+             * @see sendIndicationAsync()
+             */
+            IndicationStats getIndicationStats() noexcept;
+
+            /**
+             * Returns the Client Characteristic Configuration bits as written by this connection's client
+             * for the given characteristic value handle, zero if unset or not in role GATTRole::Server.
+             *
+             * - bit 0: notification enabled
+             * - bit 1: indication enabled
+             *
+             * @param char_value_handle characteristic value handle of the referenced DBGattServer
+             * @see DBGattServer::notifyAll()
+             */
+            uint8_t getClientCharConfig(const uint16_t char_value_handle) noexcept;
+
+            /**
+             * Returns true if in role GATTRole::Server and the connected client has enabled
+             * Multiple Handle Value Notifications in its Client Supported Features characteristic,
+             * see GattCharacteristicType::CLIENT_SUPPORTED_FEATURES.
+             *
+             * - BT Core Spec v5.2: Vol 3, Part G GATT: 7.2 Client Supported Features
+             *
+             * @see sendMultipleNotification()
+             * @see DBGattServer::flushNotifications()
+             */
+            bool isMultipleHandleValueNtfSupported() noexcept;
+
+            /**
+             * Returns the free space of the underlying L2CAP socket send queue in bytes,
+             * or a negative L2CAPClient::RWExitCode on error.
+             *
+             * @see L2CAPClient::getTxQueueSpace()
+             */
+            jau::snsize_t getTxQueueSpace() noexcept { return l2cap.getTxQueueSpace(); }
+
             /**
              * Add the given listener to the list if not already present.
              * <p>
@@ -78,7 +78,10 @@ namespace direct_bt {
 
         public:
             /**
-             * Poll timeout for mgmt reader thread, defaults to 10s.
+             * Poll timeout for mgmt reader thread, defaults to zero.
+             * <p>
+             * Zero lets the reader block until data arrives or it gets interrupted via HCIComm::wakeup().
+             * </p>
              * <p>
              * Environment variable is 'direct_bt.mgmt.reader.timeout'.
              * </p>
@@ -537,6 +537,78 @@ namespace direct_bt {
     constexpr L2CAP_PSM to_L2CAP_PSM(const uint16_t v) noexcept { return static_cast<L2CAP_PSM>(v); }
     std::string to_string(const L2CAP_PSM v) noexcept;
 
+    /**
+     * Returns true if the given L2CAP_PSM is a valid LE Simplified Protocol/Service Multiplexer (SPSM),
+     * i.e. within the fixed range [0x0001..0x007F] or the dynamic range [L2CAP_PSM::LE_DYN_START..L2CAP_PSM::LE_DYN_END].
+     * <p>
+     * BT Core Spec v5.2: Vol 3, Part A: 4.22 L2CAP_LE_CREDIT_BASED_CONNECTION_REQ
+     * </p>
+     */
+    constexpr bool is_LE_SPSM(const L2CAP_PSM v) noexcept {
+        return L2CAP_PSM::UNDEFINED < v && v <= L2CAP_PSM::LE_DYN_END;
+    }
+
+    /**
+     * L2CAP channel I/O profile, tuning its socket at open time.
+     * <p>
+     * Linux's HCI scheduler sends the ACL data of the highest socket priority first across all connections of an adapter,
+     * hence LOW_LATENCY control traffic does not queue behind BULK transfers on the same adapter.
+     * </p>
+     * <p>
+     * Flushability only applies to BR/EDR, where flushable ACL data may be discarded by the controller after its flush timeout.
+     * BT Core Spec v5.2: Vol 3, Part A: 5.2 Flush Timeout Option.
+     * </p>
+     * @since 2.7.0
+     */
+    enum class L2CAPIOProfile : uint8_t {
+        /** Keeps the kernel defaults, value 0. */
+        DEFAULT     = 0,
+        /** Interactive control traffic, e.g. ATT: High socket priority, small send buffer bounding queued data, non-flushable and forced active link. Value 1. */
+        LOW_LATENCY = 1,
+        /** Streaming bulk data, e.g. LE CoC: Default socket priority, large send and receive buffers, flushable and allowing link power saving. Value 2. */
+        BULK        = 2
+    };
+    constexpr uint8_t number(const L2CAPIOProfile rhs) noexcept {
+        return static_cast<uint8_t>(rhs);
+    }
+    std::string to_string(const L2CAPIOProfile v) noexcept;
+
+    /**
+     * L2CAP channel I/O statistics, counted per connection by L2CAPClient.
+     * @see L2CAPClient::getStats()
+     * @see BTDevice::getL2CAPStats()
+     * @see BTAdapter::getL2CAPStats()
+     * @since 2.7.0
+     */
+    struct L2CAPStats {
+        /** Number of received packets. */
+        uint64_t reads = 0;
+        /** Number of received bytes. */
+        uint64_t bytes_read = 0;
+        /** Number of sent packets. */
+        uint64_t writes = 0;
+        /** Number of sent bytes. */
+        uint64_t bytes_written = 0;
+        /** Number of `EAGAIN` or `EINTR` retries, including non-blocking sends hitting a full socket send queue. */
+        uint64_t eagain_retries = 0;
+        /** Number of read poll timeouts or wakeups without data, RWExitCode::POLL_TIMEOUT. */
+        uint64_t poll_timeouts = 0;
+        /** Number of reads and writes interrupted by a closing channel or an external cause, RWExitCode::INTERRUPTED. */
+        uint64_t interrupts = 0;
+        /** Number of read errors, i.e. RWExitCode::POLL_ERROR, RWExitCode::READ_ERROR or RWExitCode::READ_TIMEOUT. */
+        uint64_t read_errors = 0;
+        /** Number of write errors, i.e. RWExitCode::WRITE_ERROR. */
+        uint64_t write_errors = 0;
+        /** Number of rejected queued writes due to a full send queue, RWExitCode::QUEUE_FULL. */
+        uint64_t queue_full = 0;
+        /** Time spent in blocking writes in microseconds. */
+        uint64_t write_blocked_us = 0;
+
+        L2CAPStats& operator+=(const L2CAPStats& o) noexcept;
+
+        std::string toString() const noexcept;
+    };
+
     /**
      * BT Core Spec v5.2:  Vol 3, Part A L2CAP Spec: 6 State Machine
      */
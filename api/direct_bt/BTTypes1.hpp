@@ -78,15 +78,35 @@ namespace direct_bt {
      * int8_t rssi,
      * int8_t tx_power,
      * int8_t max_tx_power;
+     *
+     * Completed by BTDevice::getConnectionInfo() with the link's throughput parameters,
+     * i.e. LE_PHYs, LE Data Length and the used ATT MTU.
      */
     class ConnectionInfo
     {
+        friend class BTDevice; // setLinkParameter()
+
         private:
             jau::EUI48 address;
             BDAddressType addressType;
             int8_t rssi;
             int8_t tx_power;
             int8_t max_tx_power;
+            LE_PHYs le_phy_tx = LE_PHYs::NONE;
+            LE_PHYs le_phy_rx = LE_PHYs::NONE;
+            uint16_t le_tx_octets = 0;
+            uint16_t att_mtu = 0;
+            L2CAPStats l2cap_stats;
+
+            void setLinkParameter(const LE_PHYs le_phy_tx_, const LE_PHYs le_phy_rx_, const uint16_t le_tx_octets_, const uint16_t att_mtu_) noexcept {
+                le_phy_tx = le_phy_tx_;
+                le_phy_rx = le_phy_rx_;
+                le_tx_octets = le_tx_octets_;
+                att_mtu = att_mtu_;
+            }
+            void setL2CAPStats(const L2CAPStats& l2cap_stats_) noexcept {
+                l2cap_stats = l2cap_stats_;
+            }
 
         public:
             static jau::nsize_t minimumDataSize() noexcept { return 6 + 1 + 1 + 1 + 1; }
@@ -100,10 +120,27 @@ namespace direct_bt {
             int8_t getTxPower() const noexcept { return tx_power; }
             int8_t getMaxTxPower() const noexcept { return max_tx_power; }
 
+            /** Returns the Tx LE_PHYs of the LE connection, LE_PHYs::NONE if unknown. */
+            LE_PHYs getTxPhys() const noexcept { return le_phy_tx; }
+            /** Returns the Rx LE_PHYs of the LE connection, LE_PHYs::NONE if unknown. */
+            LE_PHYs getRxPhys() const noexcept { return le_phy_rx; }
+            /** Returns the LE Data Length Tx octets accepted by the controller, zero if unset, i.e. 27 octets default. */
+            uint16_t getLETxOctets() const noexcept { return le_tx_octets; }
+            /** Returns the used ATT MTU, zero if no GATT connection exists. */
+            uint16_t getATTMTU() const noexcept { return att_mtu; }
+            /**
+             * Returns the L2CAPStats of the GATT channel of this connection.
+             * @since 2.7.0
+             */
+            const L2CAPStats& getL2CAPStats() const noexcept { return l2cap_stats; }
+
             std::string toString() const noexcept {
                 return "address="+getAddress().toString()+", addressType "+to_string(getAddressType())+
                        ", rssi "+std::to_string(rssi)+
-                       ", tx_power[set "+std::to_string(tx_power)+", max "+std::to_string(tx_power)+"]";
+                       ", tx_power[set "+std::to_string(tx_power)+", max "+std::to_string(tx_power)+"]"+
+                       ", phy[Tx "+to_string(le_phy_tx)+", Rx "+to_string(le_phy_rx)+"]"+
+                       ", le_tx_octets "+std::to_string(le_tx_octets)+", att_mtu "+std::to_string(att_mtu)+
+                       ", "+l2cap_stats.toString();
             }
     };
 
@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <mutex>
 #include <atomic>
+#include <unordered_map>
 
 #include <jau/java_uplink.hpp>
 #include <jau/octets.hpp>
@@ -69,6 +70,8 @@ namespace direct_bt {
     class BTDevice; // forward
     typedef std::shared_ptr<BTDevice> BTDeviceRef;
 
+    class BTGattHandler; // forward
+
     /** @defgroup DBTUserServerAPI Direct-BT Peripheral-Server User Level API
      *  User level Direct-BT API types and functionality addressing the peripheral-server ::GATTRole::Server perspective,
      *  , [see Direct-BT Overview](namespacedirect__bt.html#details).
@@ -78,6 +81,15 @@ namespace direct_bt {
 
     class DBGattService; // fwd
 
+    /**
+     * Reference counted immutable value buffer of a DBGattChar or DBGattDesc,
+     * see DBGattChar::publishValue() and DBGattDesc::publishValue().
+     *
+     * A published value is shared by all Gatt-Server read responses and notifications
+     * and sent via BTGattHandler's scatter-gather write without any per-consumer copy.
+     */
+    typedef std::shared_ptr<const jau::POctets> DBGattValueRef;
+
     /**
      * Representing a Gatt Characteristic Descriptor object from the ::GATTRole::Server perspective.
      *
@@ -102,6 +114,8 @@ namespace direct_bt {
 
             bool variable_length;
 
+            DBGattValueRef value_snapshot;
+
         public:
             /**
              * Characteristic Descriptor Handle
@@ -143,6 +157,27 @@ namespace direct_bt {
              */
             bool setValue(const uint8_t* source, const jau::nsize_t source_len, const jau::nsize_t dest_pos) noexcept;
 
+            /**
+             * Atomically publishes a copy of the given server owned value as this descriptor's immutable value snapshot,
+             * see DBGattChar::publishValue().
+             *
+             * @param v the value to publish
+             * @see getValueSnapshot()
+             */
+            void publishValue(const jau::TROOctets & v) noexcept;
+
+            /**
+             * Returns the latest published immutable value snapshot or `nullptr` if publishValue() has never been called.
+             * @see publishValue()
+             */
+            DBGattValueRef getValueSnapshot() const noexcept { return std::atomic_load(&value_snapshot); }
+
+            /**
+             * Replaces the published value snapshot with the given one, used by the Gatt-Server for client writes.
+             * @see publishValue()
+             */
+            void publishValueSnapshot(const DBGattValueRef& v) noexcept { std::atomic_store(&value_snapshot, v); }
+
             static std::string java_class() noexcept {
                 return std::string(JAVA_MAIN_PACKAGE "DBGattDesc");
             }
@@ -165,7 +200,8 @@ namespace direct_bt {
              */
             DBGattDesc(const std::shared_ptr<const jau::uuid_t>& type_,
                        jau::POctets && value_, bool variable_length_=false) noexcept
-            : handle(0), type(type_), value( std::move( value_ ) ), variable_length(variable_length_)
+            : handle(0), type(type_), value( std::move( value_ ) ), variable_length(variable_length_),
+              value_snapshot(nullptr)
             {
                 if( variable_length && ( isExtendedProperties() || isClientCharConfig() ) ) {
                     variable_length = false;
@@ -180,7 +216,8 @@ namespace direct_bt {
             DBGattDesc(const DBGattDesc &o)
             : handle(o.handle), type(o.type),
               value(o.value, o.value.capacity()),
-              variable_length(o.variable_length)
+              variable_length(o.variable_length),
+              value_snapshot(o.getValueSnapshot())
             {
                 JAU_TRACE_DBGATT_PRINT("DBGattDesc ctor-cpy0: %p -> %p", &o, this);
             }
@@ -192,7 +229,8 @@ namespace direct_bt {
             DBGattDesc(DBGattDesc &&o) noexcept
             : handle(std::move(o.handle)), type(std::move(o.type)),
               value(std::move(o.value)),
-              variable_length(std::move(o.variable_length))
+              variable_length(std::move(o.variable_length)),
+              value_snapshot(std::atomic_load(&o.value_snapshot))
             {
                 JAU_TRACE_DBGATT_PRINT("DBGattDesc ctor-move0: %p -> %p", &o, this);
             }
@@ -285,6 +323,11 @@ namespace direct_bt {
 
             int userDescriptionIndex;
 
+            bool per_connection_value;
+
+            /** Published immutable value, accessed via std::atomic_load() and std::atomic_store() only. */
+            DBGattValueRef value_snapshot;
+
         public:
             /**
              * Characteristic Handle of this instance.
@@ -348,6 +391,50 @@ namespace direct_bt {
              */
             bool setValue(const uint8_t* source, const jau::nsize_t source_len, const jau::nsize_t dest_pos) noexcept;
 
+            /**
+             * Atomically publishes a copy of the given server owned value as this characteristic's immutable value snapshot.
+             *
+             * Once published, the Gatt-Server serves all client reads from the latest snapshot
+             * and applies client writes copy-on-write, publishing a new snapshot, i.e. last writer wins.
+             * Readers never observe a partially written value and no external database lock is required.
+             *
+             * The snapshot is shared by all read responses and notifications without further copies,
+             * see DBGattServer::notifyAll(const DBGattCharRef&).
+             *
+             * The capacity of getValue() remains the limit of a variable length value.
+             *
+             * @param v the value to publish
+             * @see getValueSnapshot()
+             */
+            void publishValue(const jau::TROOctets & v) noexcept;
+
+            /**
+             * Returns the latest published immutable value snapshot or `nullptr` if publishValue() has never been called.
+             * @see publishValue()
+             */
+            DBGattValueRef getValueSnapshot() const noexcept { return std::atomic_load(&value_snapshot); }
+
+            /**
+             * Replaces the published value snapshot with the given one, used by the Gatt-Server for client writes.
+             * @see publishValue()
+             */
+            void publishValueSnapshot(const DBGattValueRef& v) noexcept { std::atomic_store(&value_snapshot, v); }
+
+            /**
+             * Returns true if each connected client owns its own value of this characteristic, see setPerConnectionValue().
+             */
+            bool hasPerConnectionValue() const noexcept { return per_connection_value; }
+
+            /**
+             * Set whether each connected client owns its own value of this characteristic, defaults to false.
+             *
+             * If true, client writes are kept by the Gatt-Server per connection and only read back by the same client,
+             * starting with a copy of the shared value. The shared value is not modified by clients.
+             *
+             * Method can only be issued before passing the DBGattServer instance to BTAdapter::startAdvertising().
+             */
+            void setPerConnectionValue(const bool v) noexcept { per_connection_value = v; }
+
             /* Optional Client Characteristic Configuration index within descriptorList */
             int getClientCharConfigIndex() const noexcept { return clientCharConfigIndex; }
 
@@ -386,7 +473,9 @@ namespace direct_bt {
               descriptors( std::move( descriptors_ ) ),
               value( std::move( value_ ) ), variable_length(variable_length_),
               clientCharConfigIndex(-1),
-              userDescriptionIndex(-1)
+              userDescriptionIndex(-1),
+              per_connection_value(false),
+              value_snapshot(nullptr)
             {
                 int i=0;
                 // C++11: Range-based for loop: [begin, end[
@@ -413,7 +502,9 @@ namespace direct_bt {
               value(o.value, o.value.capacity()),
               variable_length(o.variable_length),
               clientCharConfigIndex(o.clientCharConfigIndex),
-              userDescriptionIndex(o.userDescriptionIndex)
+              userDescriptionIndex(o.userDescriptionIndex),
+              per_connection_value(o.per_connection_value),
+              value_snapshot(o.getValueSnapshot())
             {
                 JAU_TRACE_DBGATT_PRINT("DBGattChar: ctor-copy0: %p -> %p", &o, this);
             }
@@ -430,7 +521,9 @@ namespace direct_bt {
               value(std::move(o.value)),
               variable_length(std::move(o.variable_length)),
               clientCharConfigIndex(std::move(o.clientCharConfigIndex)),
-              userDescriptionIndex(std::move(o.userDescriptionIndex))
+              userDescriptionIndex(std::move(o.userDescriptionIndex)),
+              per_connection_value(std::move(o.per_connection_value)),
+              value_snapshot(std::atomic_load(&o.value_snapshot))
             {
                 JAU_TRACE_DBGATT_PRINT("DBGattChar: ctor-move0: %p -> %p", &o, this);
             }
@@ -789,6 +882,9 @@ namespace direct_bt {
                     /**
                      * Notifies a change of the Client Characteristic Configuration Descriptor (CCCD) value.
                      *
+                     * The CCCD value is kept per connection, i.e. the shared DBGattDesc value is not modified,
+                     * see BTGattHandler::getClientCharConfig().
+                     *
                      * @param device
                      * @param s
                      * @param c
@@ -813,7 +909,65 @@ namespace direct_bt {
             };
             typedef std::shared_ptr<Listener> ListenerRef;
 
+            /**
+             * Entry of the attribute handle table, indexed by its attribute handle.
+             *
+             * References the owning DBGattService, DBGattChar and DBGattDesc of its attribute handle,
+             * the latter two are `nullptr` if not applicable.
+             *
+             * @see findAttribute()
+             * @see setServicesHandles()
+             */
+            struct Attribute {
+                /** Type of an Attribute table entry. */
+                enum class Type : uint8_t {
+                    /** Unused attribute handle */
+                    NONE = 0,
+                    /** Service Declaration, handle of DBGattService */
+                    SERVICE = 1,
+                    /** Characteristic Declaration, handle of DBGattChar */
+                    CHAR_DECL = 2,
+                    /** Characteristic Value, value handle of DBGattChar */
+                    CHAR_VALUE = 3,
+                    /** Characteristic Descriptor, handle of DBGattDesc */
+                    DESC = 4
+                };
+                Type type = Type::NONE;
+                DBGattServiceRef service = nullptr;
+                DBGattCharRef characteristic = nullptr;
+                DBGattDescRef descriptor = nullptr;
+            };
+
+            /**
+             * Result of notifyAll().
+             */
+            struct NotifyAllResult {
+                /** Number of connected clients having notifications enabled for the characteristic. */
+                jau::nsize_t subscribed = 0;
+                /** Number of clients the notification has been sent to. */
+                jau::nsize_t sent = 0;
+                /** Number of distinct PDU sizes sent, i.e. number of used ATT_MTU size classes. */
+                jau::nsize_t pdu_count = 0;
+                /** Clients where sending failed, e.g. due to an IO error or disconnect. */
+                jau::darray<BTDeviceRef> failed;
+                /** Clients skipped as their L2CAP send queue could not take the notification without blocking. */
+                jau::darray<BTDeviceRef> saturated;
+
+                /** Returns true if the notification has been sent to all subscribed clients. */
+                bool isComplete() const noexcept { return sent == subscribed; }
+
+                std::string toString() const noexcept;
+            };
+
+            /** Copy-on-write attribute handle table type, see getAttributeTable(). */
+            typedef jau::cow_darray<Attribute> AttributeTable_t;
+            /** Immutable attribute handle table snapshot, index is the attribute handle. */
+            typedef AttributeTable_t::storage_t AttributeTable;
+            /** Reference to an attribute handle table snapshot, see getAttributeTable(). */
+            typedef AttributeTable_t::storage_ref_t AttributeTableRef;
+
         private:
+            friend BTGattHandler;
             typedef jau::cow_darray<ListenerRef> ListenerList_t;
             ListenerList_t listenerList;
 
@@ -821,10 +975,42 @@ namespace direct_bt {
 
             jau::darray<DBGattServiceRef> services;
 
+            /**
+             * Dense attribute handle table, index is the attribute handle, index 0 is unused.
+             *
+             * Rebuilt tables are published copy-on-write, see getAttributeTable().
+             */
+            AttributeTable_t attributes;
+
+            /** Connected client devices, maintained by BTGattHandler in GATTRole::Server. */
+            jau::cow_darray<BTDeviceRef> connectedDevices;
+
+            /** Discovery response cache, see getCachedResponse(). */
+            std::mutex mtx_rspCache;
+            std::unordered_map<uint64_t, std::shared_ptr<const AttPDUMsg>> rspCache;
+            std::weak_ptr<const void> rspCacheSource;
+
+            /** Pending notification value of a characteristic, see queueNotification(). */
+            struct PendingNotification {
+                DBGattCharRef characteristic;
+                DBGattValueRef value;
+            };
+            /** Pending notifications, at most one per characteristic in queued order, see flushNotifications(). */
+            std::mutex mtx_pendingNtf;
+            jau::darray<PendingNotification> pendingNtf;
+
             BTDeviceRef fwdServer; // FWD mode
+            bool fwdPipelined; // FWD mode
 
             Mode mode;
 
+            void buildAttributeTable();
+
+            bool queueNotification(const DBGattCharRef& c, const DBGattValueRef& value) noexcept;
+
+            bool addConnectedDevice(const BTDeviceRef& device) noexcept;
+            bool removeConnectedDevice(const BTDeviceRef& device) noexcept;
+
         public:
             /** Used maximum server Rx ATT_MTU, defaults to 512+1. */
             uint16_t getMaxAttMTU() const noexcept { return max_att_mtu; }
@@ -844,6 +1030,11 @@ namespace direct_bt {
 
             BTDeviceRef getFwdServer() noexcept { return fwdServer; }
 
+            /**
+             * Returns true if this Mode::FWD DBGattServer proxies in pipelined mode, see DBGattServer(BTDeviceRef, bool).
+             */
+            bool isFwdPipelined() const noexcept { return fwdPipelined; }
+
             static std::string java_class() noexcept {
                 return std::string(JAVA_MAIN_PACKAGE "DBGattServer");
             }
@@ -866,6 +1057,7 @@ namespace direct_bt {
             : max_att_mtu(512+1),
               services( ),
               fwdServer( nullptr ),
+              fwdPipelined( false ),
               mode(Mode::NOP)
             { }
 
@@ -878,6 +1070,7 @@ namespace direct_bt {
             : max_att_mtu(std::min<uint16_t>(512+1, max_att_mtu_)),
               services( std::move( services_ ) ),
               fwdServer( nullptr ),
+              fwdPipelined( false ),
               mode( services.size() > 0 ? Mode::DB : Mode::NOP )
             { }
 
@@ -891,18 +1084,39 @@ namespace direct_bt {
             : max_att_mtu(512+1),
               services( std::move( services_ ) ),
               fwdServer( nullptr ),
+              fwdPipelined( false ),
               mode( services.size() > 0 ? Mode::DB : Mode::NOP )
             { }
 
             /**
              * DBGattServer in Mode::FWD to the given forward BTDevice.
              *
+             * By default, each ATT request is forwarded to the forward server and its reply awaited before replying to the client.
+             *
+             * In pipelined mode, the proxy avoids the synchronous round trip where the protocol permits:
+             * - Discovery responses of the forward server are cached and answered locally for all subsequent clients,
+             *   i.e. ATT_FIND_INFORMATION_REQ, ATT_READ_BY_TYPE_REQ for characteristic and include declarations
+             *   and ATT_READ_BY_GROUP_TYPE_REQ for service declarations.
+             *   The cache is cleared once the forward server's GATT connection has been renewed.
+             * - Notifications and indications of the forward server are streamed directly to the client
+             *   from the forward server's reader thread w/o blocking, using BTGattHandler::sendNotificationAsync() and BTGattHandler::sendIndicationAsync(),
+             *   if enabled by the client's Client Characteristic Configuration, see BTGattHandler::getClientCharConfig().
+             * - Write commands are queued and forwarded asynchronously, not blocking the client's reader thread,
+             *   see BTGattEnv::GATT_FWD_WRITE_CMD_QUEUE_CAPACITY.
+             *   Any other forwarded request waits until all queued write commands have been sent, preserving the client's ATT PDU order.
+             *
+             * Pipelined mode expects the forward server's GATT database to remain unchanged while connected.
+             * Its forwarding of notifications and indications replaces any application level forwarding
+             * via BTGattHandler::NativeGattCharListener.
+             *
              * @param fwdServer_
+             * @param fwdPipelined_ pass true for pipelined mode, defaults to false
              */
-            DBGattServer(BTDeviceRef fwdServer_)
+            DBGattServer(BTDeviceRef fwdServer_, const bool fwdPipelined_=false)
             : max_att_mtu(512+1),
               services( ),
               fwdServer( fwdServer_ ),
+              fwdPipelined( fwdPipelined_ ),
               mode( Mode::FWD )
             { }
 
@@ -937,14 +1151,61 @@ namespace direct_bt {
                 return true;
             }
 
+            /**
+             * Returns the current attribute handle table snapshot.
+             *
+             * The table is rebuilt by setServicesHandles() into a new instance and published copy-on-write,
+             * hence the returned snapshot and all Attribute pointers retrieved from it via findAttribute()
+             * stay valid as long as the snapshot is being held, even if services are changed concurrently.
+             *
+             * Requires handles to be set via setServicesHandles().
+             */
+            AttributeTableRef getAttributeTable() const noexcept { return attributes.snapshot(); }
+
+            /**
+             * Returns the Attribute of the given attribute handle within the given table snapshot in O(1)
+             * or `nullptr` if the handle is not in use.
+             *
+             * The returned pointer is only valid while the table snapshot is being held.
+             * @see getAttributeTable()
+             */
+            static const Attribute* findAttribute(const AttributeTable& table, const uint16_t handle) noexcept {
+                if( handle >= table.size() || Attribute::Type::NONE == table[handle].type ) {
+                    return nullptr;
+                }
+                return &table[handle];
+            }
+
+            /**
+             * Returns the last attribute handle in use within the given table snapshot, inclusive, or zero if none is set.
+             *
+             * Range requests may walk the table snapshot via findAttribute() from their start handle
+             * up to the minimum of their end handle and this value.
+             */
+            static uint16_t getAttributeEndHandle(const AttributeTable& table) noexcept {
+                return table.size() > 0 ? static_cast<uint16_t>( table.size() - 1 ) : 0;
+            }
+
+            /**
+             * Returns the last attribute handle in use of the current attribute handle table, inclusive, or zero if none is set.
+             * @see getAttributeTable()
+             */
+            uint16_t getAttributeEndHandle() const noexcept {
+                return getAttributeEndHandle( *getAttributeTable() );
+            }
+
+            /**
+             * Returns the DBGattChar of the given characteristic value handle in O(1) or `nullptr` if not existing.
+             *
+             * Requires handles to be set via setServicesHandles().
+             */
             DBGattCharRef findGattCharByValueHandle(const uint16_t char_value_handle) noexcept {
-                for(DBGattServiceRef& s : services) {
-                    DBGattCharRef r = s->findGattCharByValueHandle(char_value_handle);
-                    if( nullptr != r ) {
-                        return r;
-                    }
+                const AttributeTableRef table = getAttributeTable();
+                const Attribute* a = findAttribute(*table, char_value_handle);
+                if( nullptr == a || Attribute::Type::CHAR_VALUE != a->type ) {
+                    return nullptr;
                 }
-                return nullptr;
+                return a->characteristic;
             }
 
             /**
@@ -956,8 +1217,11 @@ namespace direct_bt {
              * Method is being called by BTAdapter when advertising is enabled
              * via BTAdapter::startAdvertising().
              *
+             * Also rebuilds the attribute handle table and publishes it copy-on-write, see getAttributeTable().
+             *
              * @return number of set handles, i.e. `( end_handle - handle ) + 1`
              * @see BTAdapter::startAdvertising()
+             * @see findAttribute()
              */
             int setServicesHandles() {
                 int c = 0;
@@ -967,13 +1231,221 @@ namespace direct_bt {
                     c += l;
                     h += l; // end + 1 for next service
                 }
+                buildAttributeTable();
+                clearCachedResponses();
                 return c;
             }
 
+            /** Maximum number of cached discovery responses, see getCachedResponse(). */
+            static constexpr jau::nsize_t MAX_CACHED_RESPONSES = 1024;
+
+            /**
+             * Returns the discovery response cache key.
+             *
+             * Responses depend on the maximum response size `min(255, ATT_MTU-2)`
+             * instead of the ATT_MTU, hence all ATT_MTU values above 257 share their cached responses.
+             *
+             * @param opc the request opcode
+             * @param start_handle the requested start handle
+             * @param end_handle the requested end handle
+             * @param type the requested attribute group type, zero if not applicable
+             * @param rsp_max_size the maximum response size `min(255, ATT_MTU-2)`
+             */
+            static constexpr uint64_t getResponseCacheKey(const AttPDUMsg::Opcode opc, const uint16_t start_handle, const uint16_t end_handle,
+                                                          const uint16_t type, const jau::nsize_t rsp_max_size) noexcept {
+                return static_cast<uint64_t>( static_cast<uint8_t>(opc) ) << 56 |
+                       static_cast<uint64_t>( std::min<jau::nsize_t>(255, rsp_max_size) ) << 48 |
+                       static_cast<uint64_t>( type ) << 32 |
+                       static_cast<uint64_t>( start_handle ) << 16 |
+                       static_cast<uint64_t>( end_handle );
+            }
+
+            /**
+             * Returns the cached discovery response PDU for the given key, see getResponseCacheKey(), or `nullptr`.
+             *
+             * Discovery responses, i.e. ATT_READ_BY_GROUP_TYPE_RSP, ATT_READ_BY_TYPE_RSP and ATT_FIND_INFORMATION_RSP
+             * including their ATT_ERROR_RSP, only depend on the immutable database after setServicesHandles(),
+             * hence reconnecting clients are served from the pre-serialized PDUs.
+             *
+             * The cache is cleared by setServicesHandles() and clearCachedResponses().
+             */
+            std::shared_ptr<const AttPDUMsg> getCachedResponse(const uint64_t key) noexcept;
+
+            /** Caches a copy of the given discovery response PDU, see getCachedResponse(). */
+            void putCachedResponse(const uint64_t key, const AttPDUMsg& rsp) noexcept;
+
+            /**
+             * Clears the discovery response cache, see getCachedResponse().
+             *
+             * Shall be called if the database layout has been modified after setServicesHandles(),
+             * e.g. a characteristic's properties or a descriptor's type.
+             */
+            void clearCachedResponses() noexcept;
+
+            /**
+             * Clears the discovery response cache if the given source differs from the previous one,
+             * used to invalidate cached responses of a Mode::FWD server, see isFwdPipelined().
+             *
+             * @param source the current source of the cached responses, i.e. the forward server's BTGattHandler
+             */
+            void setCachedResponsesSource(const std::shared_ptr<const void>& source) noexcept;
+
             bool addListener(ListenerRef l);
             bool removeListener(ListenerRef l);
             jau::cow_darray<ListenerRef>& listener() { return listenerList; }
 
+            /** Returns the number of currently connected client devices. */
+            jau::nsize_t getConnectedDeviceCount() noexcept { return connectedDevices.size(); }
+
+            /**
+             * Send a notification of the given characteristic `value` to all connected clients,
+             * which have enabled notifications via their own Client Characteristic Configuration.
+             *
+             * The 3 octet notification PDU header is built only once and written together with the shared `value`
+             * via BTGattHandler::sendScattered(), i.e. the value is not copied per client or ATT_MTU size class.
+             * The characteristic is validated once, and subscribers are determined from each connection's CCCD state,
+             * see BTGattHandler::getClientCharConfig().
+             *
+             * All PDUs are written in one batch after all targets have been determined.
+             * Clients whose L2CAP send queue cannot take the PDU without blocking are skipped
+             * and reported as saturated, allowing the caller to retry or drop the update for these clients.
+             *
+             * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.10 Characteristic Value Notification
+             *
+             * @param c the characteristic of this DBGattServer, must have BTGattChar::PropertyBitVal::Notify
+             * @param value the value to notify, truncated to each client's ATT_MTU-3
+             * @return NotifyAllResult summary including failed and saturated clients
+             * @see BTDevice::sendNotification()
+             */
+            NotifyAllResult notifyAll(const DBGattCharRef& c, const jau::TROOctets & value) noexcept;
+
+            /**
+             * Send a notification of the given characteristic's current value to all connected clients,
+             * see notifyAll(const DBGattCharRef&, const jau::TROOctets&).
+             *
+             * The latest published DBGattChar::getValueSnapshot() is used if available,
+             * otherwise DBGattChar::getValue().
+             * The snapshot is referenced while sending, hence a concurrent DBGattChar::publishValue() is safe.
+             *
+             * @param c the characteristic of this DBGattServer, must have BTGattChar::PropertyBitVal::Notify
+             * @return NotifyAllResult summary including failed and saturated clients
+             */
+            NotifyAllResult notifyAll(const DBGattCharRef& c) noexcept;
+
+            /**
+             * Queue a notification of the given characteristic `value` for the next flushNotifications().
+             *
+             * A copy of the value is queued, replacing a still pending value of the same characteristic,
+             * i.e. only the latest value of each characteristic is sent.
+             *
+             * @param c the characteristic of this DBGattServer, must have BTGattChar::PropertyBitVal::Notify
+             * @param value the value to notify
+             * @return true if queued, otherwise false if the characteristic is invalid
+             * @see flushNotifications()
+             */
+            bool queueNotification(const DBGattCharRef& c, const jau::TROOctets & value) noexcept;
+
+            /**
+             * Queue a notification of the given characteristic's current value for the next flushNotifications().
+             *
+             * The latest published DBGattChar::getValueSnapshot() is queued without a copy if available,
+             * otherwise a copy of DBGattChar::getValue().
+             *
+             * @param c the characteristic of this DBGattServer, must have BTGattChar::PropertyBitVal::Notify
+             * @return true if queued, otherwise false if the characteristic is invalid
+             * @see queueNotification(const DBGattCharRef&, const jau::TROOctets&)
+             */
+            bool queueNotification(const DBGattCharRef& c) noexcept;
+
+            /** Returns the number of characteristics with a pending notification, see queueNotification(). */
+            jau::nsize_t getPendingNotificationCount() noexcept;
+
+            /**
+             * Send all pending notifications queued via queueNotification() to all connected clients,
+             * which have enabled notifications via their own Client Characteristic Configuration.
+             *
+             * If a client has enabled Multiple Handle Value Notifications in its Client Supported Features,
+             * see BTGattHandler::isMultipleHandleValueNtfSupported(), its pending values are batched
+             * into as few ATT_MULTIPLE_HANDLE_VALUE_NTF PDUs as its ATT_MTU allows.
+             * Otherwise, or for a single remaining value or a value exceeding the ATT_MTU,
+             * a regular ATT_HANDLE_VALUE_NTF is sent, see BTGattHandler::sendNotification().
+             *
+             * Several characteristics changed within the same period hence cost only one PDU and link layer packet per client.
+             *
+             * - BT Core Spec v5.2: Vol 3, Part G GATT: 4.10.2 Multiple Variable Length Notifications
+             * - BT Core Spec v5.2: Vol 3, Part G GATT: 7.2 Client Supported Features
+             *
+             * @return NotifyAllResult summary, where NotifyAllResult::subscribed counts clients with at least one subscribed pending value,
+             *         NotifyAllResult::sent the completely served clients and NotifyAllResult::pdu_count all sent PDUs.
+             * @see queueNotification()
+             */
+            NotifyAllResult flushNotifications() noexcept;
+
+            /** Compact binary image magic, i.e. `DBGS` in little endian, see toBinary(). */
+            static constexpr uint32_t BINARY_MAGIC = 0x53474244;
+            /** Compact binary image version, see toBinary(). */
+            static constexpr uint16_t BINARY_VERSION = 1;
+
+            /**
+             * Returns a compact binary image of this Mode::DB database, see fromBinary().
+             *
+             * The image stores each distinct UUID once in a leading table referenced by index
+             * and the flat list of services, characteristics and descriptors in handle order,
+             * all in little endian:
+             * <pre>
+             *   header  := uint32_t magic, uint16_t version, uint16_t max_att_mtu, uint16_t uuid_count, uint16_t service_count
+             *   uuid    := uint8_t size, uint8_t value[size]
+             *   service := uint8_t primary, uint16_t uuid_idx, uint16_t char_count, char[char_count]
+             *   char    := uint16_t uuid_idx, uint8_t properties, uint8_t flags, value, uint8_t desc_count, desc[desc_count]
+             *   desc    := uint16_t uuid_idx, uint8_t flags, value
+             *   value   := uint16_t capacity, uint16_t size, uint8_t data[size]
+             *   flags   := bit 0: variable length, bit 1: DBGattChar::hasPerConnectionValue()
+             * </pre>
+             *
+             * The published value snapshot is stored if available, otherwise the value.
+             * Runtime state like attribute handles, listener and connected clients are not stored.
+             *
+             * Only a Mode::DB database can be stored, as a Mode::FWD or Mode::NOP instance would not round-trip via fromBinary().
+             *
+             * @return the binary image or an empty image if not in Mode::DB
+             *         or if a count or size exceeds its field width above, e.g. a value larger than 65535 bytes or more than 255 descriptors
+             * @see write()
+             */
+            jau::POctets toBinary();
+
+            /**
+             * Returns a new Mode::DB DBGattServer instantiated from the given binary image, see toBinary().
+             *
+             * Instantiation allocates each distinct UUID only once, shared by all its attributes,
+             * and sizes all lists upfront.
+             *
+             * @param data the binary image
+             * @param size the binary image size in bytes
+             * @return the new instance or nullptr if the image is invalid
+             */
+            static std::shared_ptr<DBGattServer> fromBinary(const uint8_t* data, const jau::nsize_t size) noexcept;
+
+            /**
+             * Write this Mode::DB database as a binary image to the given file, see toBinary().
+             *
+             * @param fname the file name
+             * @param overwrite if true, an existing file is overwritten, otherwise this method fails if the file exists
+             * @return true if successful, otherwise false, e.g. if toBinary() returns an empty image
+             * @see read()
+             */
+            bool write(const std::string& fname, const bool overwrite) noexcept;
+
+            /**
+             * Returns a new Mode::DB DBGattServer instantiated from the given binary image file, see fromBinary().
+             *
+             * The file is memory mapped read-only for the duration of the instantiation, i.e. not read into an intermediate buffer.
+             *
+             * @param fname the file name
+             * @return the new instance or nullptr if the file could not be read or its image is invalid
+             * @see write()
+             */
+            static std::shared_ptr<DBGattServer> read(const std::string& fname) noexcept;
+
             std::string toFullString() {
                 std::string res = toString()+"\n";
                 for(DBGattServiceRef& s : services) {
@@ -120,6 +120,8 @@ enum GattCharacteristicType : uint16_t {
     // GENERIC_ATTRIBUTE
     //
     SERVICE_CHANGED                             = 0x2a05,
+    /** Client Supported Features, bit 0: Robust Caching, bit 1: EATT, bit 2: Multiple Handle Value Notifications. BT Core Spec v5.2: Vol 3, Part G GATT: 7.2 */
+    CLIENT_SUPPORTED_FEATURES                   = 0x2B29,
 
     /** Mandatory: sint16 10^-2: Celsius */
     TEMPERATURE                                 = 0x2A6E,
@@ -70,7 +70,7 @@ namespace direct_bt {
             jau::relaxed_atomic_int socket_descriptor; // the hci socket
             jau::sc_atomic_bool interrupted_intern; // for forced disconnect and read interruption via close()
             get_boolean_callback_t is_interrupted_extern; // for forced disconnect and read interruption via external event
-            std::atomic<pthread_t> tid_read;
+            int wakeup_fd; // eventfd to interrupt poll() of read, see wakeup()
 
         public:
             /** Constructing a newly opened HCI communication channel instance */
@@ -82,7 +82,7 @@ namespace direct_bt {
             /**
              * Releases this instance after issuing {@link #close()}.
              */
-            ~HCIComm() noexcept { close(); }
+            ~HCIComm() noexcept;
 
             bool is_open() const noexcept { return 0 <= socket_descriptor; }
 
@@ -92,6 +92,15 @@ namespace direct_bt {
             /** Returns true if interrupted by internal or external cause, hence shall stop connecting and reading. */
             bool interrupted() const noexcept { return interrupted_intern || ( !is_interrupted_extern.isNullType() && is_interrupted_extern(0/*dummy*/) ); }
 
+            /**
+             * Wakes up a thread blocking in read() via an eventfd.
+             * <p>
+             * The woken read() returns -1 with errno ETIMEDOUT if not interrupted(),
+             * hence an external cause shall be signaled before, e.g. via jau::service_runner::set_shall_stop().
+             * </p>
+             */
+            void wakeup() noexcept;
+
             /** Closing the HCI channel, locking {@link #mutex_write()}. */
             void close() noexcept;
 
@@ -101,7 +110,12 @@ namespace direct_bt {
             /** Return the recursive write mutex for multithreading access. */
             inline std::recursive_mutex & mutex_write() noexcept { return mtx_write; }
 
-            /** Generic read w/ own timeout, w/o locking suitable for a unique ringbuffer sink. */
+            /**
+             * Generic read w/ own timeout, w/o locking suitable for a unique ringbuffer sink.
+             * <p>
+             * A zero timeout blocks until data arrives or until woken up via wakeup().
+             * </p>
+             */
             jau::snsize_t read(uint8_t* buffer, const jau::nsize_t capacity, const jau::fraction_i64& timeout) noexcept;
 
             /** Generic write, locking {@link #mutex_write()}. */
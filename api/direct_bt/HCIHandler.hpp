@@ -79,7 +79,10 @@ namespace direct_bt {
 
         public:
             /**
-             * Poll timeout for HCI reader thread, defaults to 10s.
+             * Poll timeout for HCI reader thread, defaults to zero.
+             * <p>
+             * Zero lets the reader block until data arrives or it gets interrupted via HCIComm::wakeup().
+             * </p>
              * <p>
              * Environment variable is 'direct_bt.hci.reader.timeout'.
              * </p>
@@ -140,6 +143,18 @@ namespace direct_bt {
              */
             const bool DEBUG_SCAN_AD_EIR;
 
+            /**
+             * Automatic LE throughput profile for each new LE connection, defaults to false.
+             * <p>
+             * If enabled and supported by both sides, the LE Data Length is set to its maximum of 251 octets
+             * and the LE_PHYs::LE_2M PHY is requested, see BTDevice::setConnectedLE_DataLength() and BTDevice::setConnectedLE_PHY().
+             * </p>
+             * <p>
+             * Environment variable is 'direct_bt.hci.le.throughput.auto'.
+             * </p>
+             */
+            const bool HCI_LE_THROUGHPUT_AUTO;
+
         private:
             /** Maximum number of packets to wait for until matching a sequential command. Won't block as timeout will limit. */
             const int32_t HCI_READ_PACKET_MAX_RETRY;
@@ -733,6 +748,23 @@ namespace direct_bt {
             HCIStatusCode le_set_phy(const uint16_t conn_handle, const BDAddressAndType& peerAddressAndType,
                                      const LE_PHYs Tx, const LE_PHYs Rx) noexcept;
 
+            /**
+             * Sets the preferred maximum LE Link Layer transmission payload size and time for the given connection.
+             *
+             * - BT Core Spec v5.2: Vol 4, Part E, 7.8.33 LE Set Data Length command
+             * - BT Core Spec v5.2: Vol 4, Part E, 7.7.65.7 LE Data Length Change event
+             *
+             * Returns HCIStatusCode::UNSUPPORTED_FEATURE_OR_PARAM_VALUE if LE_Features::LE_Data_Pkt_Len_Ext is not supported by the adapter.
+             *
+             * @param conn_handle
+             * @param peerAddressAndType
+             * @param tx_octets preferred maximum number of payload octets, range [27..251]
+             * @param tx_time preferred maximum number of microseconds to transmit a packet, range [328..17040]
+             * @return
+             */
+            HCIStatusCode le_set_data_length(const uint16_t conn_handle, const BDAddressAndType& peerAddressAndType,
+                                             const uint16_t tx_octets, const uint16_t tx_time) noexcept;
+
         private:
             /**
              * Sets LE advertising parameters.
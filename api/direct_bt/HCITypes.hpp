@@ -433,6 +433,7 @@ namespace direct_bt {
         LE_ENABLE_ENC               = 0x2019,
         LE_LTK_REPLY_ACK            = 0x201A,
         LE_LTK_REPLY_REJ            = 0x201B,
+        LE_SET_DATA_LENGTH          = 0x2022,
         LE_READ_PHY                 = 0x2030,
         LE_SET_DEFAULT_PHY          = 0x2031,
         LE_SET_PHY                  = 0x2032,
@@ -482,6 +483,7 @@ namespace direct_bt {
         LE_ENABLE_ENC               = 39,
         LE_LTK_REPLY_ACK            = 40,
         LE_LTK_REPLY_REJ            = 41,
+        LE_SET_DATA_LENGTH          = 42,
         LE_READ_PHY                 = 46,
         LE_SET_DEFAULT_PHY          = 47,
         LE_SET_PHY                  = 48,
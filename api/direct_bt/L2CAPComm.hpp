@@ -33,10 +33,14 @@
 
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <thread>
 
 #include <jau/environment.hpp>
 #include <jau/uuid.hpp>
 #include <jau/function_def.hpp>
+#include <jau/darray.hpp>
+#include <jau/octets.hpp>
 
 #include "BTTypes0.hpp"
 
@@ -50,6 +54,8 @@
 namespace direct_bt {
 
     class BTDevice; // forward
+    class L2CAPConnectScheduler; // forward
+    class L2CAPLoopback; // forward
 
     /** \addtogroup DBTSystemAPI
      *
@@ -70,7 +76,11 @@ namespace direct_bt {
 
         public:
             /**
-             * L2CAP poll timeout for reading, defaults to 10s.
+             * L2CAP poll timeout for reading in milliseconds, defaults to zero.
+             * <p>
+             * Zero lets the reader block in poll() until data arrives or it gets interrupted via L2CAPComm::wakeup(),
+             * avoiding periodic wakeups of idle readers.
+             * </p>
              * <p>
              * Environment variable is 'direct_bt.l2cap.reader.timeout'.
              * </p>
@@ -88,6 +98,39 @@ namespace direct_bt {
              */
             const int32_t L2CAP_RESTART_COUNT_ON_ERROR;
 
+            /**
+             * Overall L2CAPClient connect deadline in milliseconds including all retries, defaults to 20s.
+             * <p>
+             * Environment variable is 'direct_bt.l2cap.connect.timeout'.
+             * </p>
+             */
+            const int32_t L2CAP_CONNECT_TIMEOUT;
+
+            /**
+             * Capacity of the L2CAPClient send queue in packets used by L2CAPClient::writeQueued(), defaults to 32 packets.
+             * <p>
+             * Environment variable is 'direct_bt.l2cap.sendqueue.capacity'.
+             * </p>
+             */
+            const int32_t L2CAP_SEND_QUEUE_CAPACITY;
+
+            /**
+             * Listen backlog of the L2CAPServer, i.e. the maximum number of pending connections queued by the kernel, defaults to 10.
+             * <p>
+             * Environment variable is 'direct_bt.l2cap.listen.backlog'.
+             * </p>
+             */
+            const int32_t L2CAP_LISTEN_BACKLOG;
+
+            /**
+             * Maximum number of worker threads concurrently performing the setup of accepted L2CAP channels
+             * in the local GATT server role, see BTAdapter, defaults to 4 threads.
+             * <p>
+             * Environment variable is 'direct_bt.l2cap.accept.workers'.
+             * </p>
+             */
+            const int32_t L2CAP_ACCEPT_WORKERS;
+
             /**
              * Debug all GATT Data communication
              * <p>
@@ -125,6 +168,14 @@ namespace direct_bt {
             /** Utilized to query for external interruption, whether device is still connected etc. */
             typedef jau::FunctionDef<bool, int /* dummy*/> get_boolean_callback_t;
 
+            /**
+             * Minimum MTU (SDU size) of an LE Credit Based Connection-oriented Channel (LE CoC), 23 octets.
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: 4.22 L2CAP_LE_CREDIT_BASED_CONNECTION_REQ
+             * </p>
+             */
+            static constexpr const uint16_t LE_COC_MIN_MTU = 23;
+
         protected:
             static int l2cap_open_dev(const BDAddressAndType & adapterAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid) noexcept;
             static int l2cap_close_dev(int dd) noexcept;
@@ -140,15 +191,31 @@ namespace direct_bt {
             const L2CAP_PSM psm;
             /** Corresponding L2CAP_CID for the channel. */
             const L2CAP_CID cid;
+            /**
+             * Requested receive MTU (SDU size) of an LE CoC channel, applied via the `BT_RCVMTU` socket option before connect() or listen().
+             * <p>
+             * Zero leaves the kernel default, as used for fixed channels like L2CAP_CID::ATT.
+             * </p>
+             */
+            const uint16_t rx_mtu;
 
         protected:
+            std::atomic<L2CAPIOProfile> io_profile;
             std::recursive_mutex mtx_open;
             jau::relaxed_atomic_int socket_; // the native socket
             jau::sc_atomic_bool is_open_; // reflects state
             jau::sc_atomic_bool interrupted_intern; // for forced disconnect and read/accept interruption via close()
             get_boolean_callback_t is_interrupted_extern; // for forced disconnect and read/accept interruption via external event
+            int wakeup_fd; // eventfd to interrupt poll() of connect, read and accept, see wakeup()
+            uint16_t loopback_mtu; // non-zero MTU of an L2CAPLoopback channel, emulating the kernel's socket options
+
+            /** Consumes pending wakeup() signals. */
+            void clear_wakeup() noexcept;
 
             bool setBTSecurityLevelImpl(const BTSecurityLevel sec_level, const BDAddressAndType& remoteAddressAndType) noexcept;
+            bool setRxMTUImpl() noexcept;
+            /** Applies the L2CAPIOProfile to the socket, best effort as not all options are supported by all transports and controllers. */
+            bool setIOProfileImpl() noexcept;
             BTSecurityLevel getBTSecurityLevelImpl(const BDAddressAndType& remoteAddressAndType) noexcept;
 
             /** Returns true if interrupted by internal cause. */
@@ -158,10 +225,10 @@ namespace direct_bt {
             bool interrupted_ext() const noexcept { return !is_interrupted_extern.isNullType() && is_interrupted_extern(0/*dummy*/); }
 
         public:
-            L2CAPComm(const uint16_t adev_id, const BDAddressAndType& localAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid) noexcept;
+            L2CAPComm(const uint16_t adev_id, const BDAddressAndType& localAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid, const uint16_t rx_mtu=0) noexcept;
 
             /** Destructor specialization shall close the L2CAP socket, see {@link #close()}. */
-            virtual ~L2CAPComm() noexcept {}
+            virtual ~L2CAPComm() noexcept;
 
             L2CAPComm(const L2CAPComm&) = delete;
             void operator=(const L2CAPComm&) = delete;
@@ -174,12 +241,58 @@ namespace direct_bt {
             /** Returns true if interrupted by internal or external cause, hence shall stop connecting and reading. */
             bool interrupted() const noexcept { return interrupted_int() || interrupted_ext(); }
 
+            /**
+             * Wakes up a thread blocking in poll() within connect, read or accept via an eventfd.
+             * <p>
+             * The woken thread returns if interrupted(), hence an external cause
+             * shall be signaled before, e.g. via jau::service_runner::set_shall_stop().
+             * Otherwise a blocking read returns L2CAPClient::RWExitCode::POLL_TIMEOUT allowing its caller to re-evaluate its state.
+             * </p>
+             * <p>
+             * Readers therefore may block indefinitely without periodic wakeups, see L2CAPEnv::L2CAP_READER_POLL_TIMEOUT.
+             * </p>
+             */
+            void wakeup() noexcept;
+
             /** Closing the L2CAP socket, see specializations. */
             virtual bool close() noexcept = 0;
 
             /** Return this L2CAP socket descriptor. */
             inline int socket() const noexcept { return socket_; }
 
+            /**
+             * Returns the PSM this socket is bound to, as reported by `getsockname()`.
+             * <p>
+             * Allows to retrieve the dynamic LE PSM allocated by the kernel
+             * for a L2CAPServer bound with L2CAP_PSM::UNDEFINED.
+             * </p>
+             * @return the bound L2CAP_PSM or L2CAP_PSM::UNDEFINED if not open or on failure
+             */
+            L2CAP_PSM getBoundPSM() const noexcept;
+
+            /**
+             * Returns the receive MTU (SDU size) of this LE CoC channel via the `BT_RCVMTU` socket option.
+             * <p>
+             * An L2CAPLoopback channel returns its emulated MTU.
+             * </p>
+             * @return the receive MTU or zero if not open, not an LE CoC channel or on failure
+             */
+            uint16_t getRxMTU() const noexcept;
+
+            /**
+             * Sets the L2CAPIOProfile, applied at open time and immediately if already open.
+             * @param p the new L2CAPIOProfile
+             * @return true if applied or not open yet, otherwise false if the open socket rejected one of its options
+             * @since 2.7.0
+             */
+            bool setIOProfile(const L2CAPIOProfile p) noexcept;
+
+            /**
+             * Returns the L2CAPIOProfile, defaults to L2CAPIOProfile::DEFAULT.
+             * @since 2.7.0
+             */
+            L2CAPIOProfile getIOProfile() const noexcept { return io_profile; }
+
             virtual std::string getStateString() const noexcept = 0;
 
             virtual std::string toString() const noexcept = 0;
@@ -189,7 +302,20 @@ namespace direct_bt {
      * L2CAP read/write communication channel to remote device
      */
     class L2CAPClient : public L2CAPComm {
+        friend class L2CAPConnectScheduler;
+        friend class L2CAPLoopback;
+
         public:
+            /**
+             * Completion callback of openAsync(), invoked on the L2CAPConnectScheduler thread
+             * or on the thread closing a pending instance.
+             * <p>
+             * The callback shall return quickly and offload any lengthy work to another thread.
+             * </p>
+             * @param connected true if the connection has been established, otherwise false and the instance is closed
+             */
+            typedef jau::FunctionDef<void, bool /* connected */> connect_callback_t;
+
             enum class Defaults : int {
                 L2CAP_CONNECT_MAX_RETRY = 3
             };
@@ -207,7 +333,8 @@ namespace direct_bt {
                 POLL_TIMEOUT        = -11,/**< POLL_TIMEOUT */
                 READ_ERROR          = -20,/**< READ_ERROR */
                 READ_TIMEOUT        = -21,/**< READ_TIMEOUT */
-                WRITE_ERROR         = -30 /**< WRITE_ERROR */
+                WRITE_ERROR         = -30,/**< WRITE_ERROR */
+                QUEUE_FULL          = -31 /**< QUEUE_FULL, backpressure of writeQueued() */
             };
             static constexpr jau::snsize_t number(const RWExitCode rhs) noexcept {
                 return static_cast<jau::snsize_t>(rhs);
@@ -224,20 +351,80 @@ namespace direct_bt {
             std::recursive_mutex mtx_write;
             BDAddressAndType remoteAddressAndType;
             std::atomic<bool> has_ioerror;  // reflects state
-            std::atomic<pthread_t> tid_connect;
-            std::atomic<pthread_t> tid_read;
+            /** Pending connect state, protected by mtx_write */
+            uint64_t connect_deadline;
+            int connect_retry_count;
+            BTSecurityLevel connect_sec_level;
+            /** Protects send_queue only, never held while sending, allowing writeQueued() to enqueue while a writer blocks on mtx_write */
+            std::mutex mtx_queue;
+            /** Pending packets of writeQueued(), protected by mtx_queue, popped only by the holder of mtx_write */
+            jau::darray<jau::POctets> send_queue;
+            /** Lock-free copy of send_queue.size() for the reader's poll() */
+            std::atomic<jau::nsize_t> send_queue_size;
+
+            /** Lock-free L2CAPStats counter, updated by the reader and writer threads. */
+            struct StatsCounter {
+                std::atomic<uint64_t> reads, bytes_read, writes, bytes_written;
+                std::atomic<uint64_t> eagain_retries, poll_timeouts, interrupts;
+                std::atomic<uint64_t> read_errors, write_errors, queue_full, write_blocked_us;
+            };
+            StatsCounter stats;
+
+            static void count(std::atomic<uint64_t>& counter, const uint64_t v=1) noexcept {
+                counter.fetch_add(v, std::memory_order_relaxed);
+            }
+            /** Counts the given RWExitCode error code of a read or write. */
+            void countError(const jau::snsize_t err_res, const bool is_read) noexcept;
+
+            /**
+             * Sends header and payload as one packet via `sendmsg()`, locking {@link #mutex_write()} is the caller's duty.
+             * @return number of bytes written if > 0, zero if non-blocking and the socket's send queue is full, otherwise RWExitCode error code.
+             */
+            jau::snsize_t sendImpl(const uint8_t *header, const jau::nsize_t header_length,
+                                   const uint8_t *payload, const jau::nsize_t payload_length, const bool nonblocking) noexcept;
+
+            /**
+             * Sends pending packets of send_queue in order, locking {@link #mutex_write()} is the caller's duty.
+             * @return number of remaining packets if >= 0, otherwise RWExitCode error code.
+             */
+            jau::snsize_t flushQueuedImpl(const bool nonblocking) noexcept;
+
+            void logWriteError(const char* prefix, const jau::snsize_t err_res, const jau::snsize_t len) noexcept;
+
+            /**
+             * Opens a new non-blocking socket and issues the connect to remoteAddressAndType, locking {@link #mutex_write()} is the caller's duty.
+             * @return zero if connected, one if the connect is in progress, otherwise negative on failure.
+             */
+            int connectStart() noexcept;
+
+            /**
+             * Progresses a pending connect after poll() signaled writability or its deadline passed,
+             * retrying on ETIMEDOUT with a new socket as long as the deadline permits.
+             * Locking {@link #mutex_write()} is the caller's duty.
+             * @param writable true if poll() signaled the socket writable, otherwise the deadline has passed
+             * @return zero if connected, one if the connect is in progress, otherwise negative on failure.
+             */
+            int connectProgress(const bool writable) noexcept;
+
+            /** Prepares remoteAddressAndType and the connect deadline state for open() and openAsync(). */
+            void connectInit(const BTDevice& device, const BTSecurityLevel sec_level) noexcept;
 
         public:
             /**
              * Constructing a non connected L2CAP channel instance for the pre-defined PSM and CID.
+             * <p>
+             * An LE Credit Based Connection-oriented Channel (LE CoC) is selected by a valid LE SPSM, see is_LE_SPSM(),
+             * and L2CAP_CID::UNDEFINED, where the given rx_mtu is requested if not zero.
+             * </p>
              */
-            L2CAPClient(const uint16_t adev_id, const BDAddressAndType& adapterAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid) noexcept;
+            L2CAPClient(const uint16_t adev_id, const BDAddressAndType& adapterAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid,
+                        const uint16_t rx_mtu=0) noexcept;
 
             /**
              * Constructing a connected L2CAP channel instance for the pre-defined PSM and CID.
              */
             L2CAPClient(const uint16_t adev_id, const BDAddressAndType& adapterAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid,
-                        const BDAddressAndType& remoteAddressAndType, int client_socket) noexcept;
+                        const BDAddressAndType& remoteAddressAndType, int client_socket, const uint16_t rx_mtu=0) noexcept;
 
             /** Destructor closing the L2CAP channel, see {@link #close()}. */
             ~L2CAPClient() noexcept { close(); }
@@ -254,6 +441,24 @@ namespace direct_bt {
              */
             bool open(const BTDevice& device, const BTSecurityLevel sec_level=BTSecurityLevel::NONE) noexcept;
 
+            /**
+             * Opens and asynchronously connects the L2CAP channel via the shared L2CAPConnectScheduler, returning immediately.
+             * <p>
+             * The non-blocking connect is retried on ETIMEDOUT within the overall deadline L2CAPEnv::L2CAP_CONNECT_TIMEOUT,
+             * where the given callback signals its completion.
+             * close() cancels the pending connect and invokes the callback with `connected` false.
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: L2CAP_CONNECTION_REQ
+             * </p>
+             *
+             * @param device the remote device to establish this L2CAP connection
+             * @param sec_level sec_level < BTSecurityLevel::NONE will not set security level
+             * @param cb the completion callback, only invoked if this method returns true
+             * @return true if the connect is pending, otherwise false and the callback will not be invoked
+             */
+            bool openAsync(const BTDevice& device, const BTSecurityLevel sec_level, const connect_callback_t& cb) noexcept;
+
             const BDAddressAndType& getRemoteAddressAndType() const noexcept { return remoteAddressAndType; }
 
             /** Closing the L2CAP channel, locking {@link #mutex_write()}. */
@@ -262,6 +467,18 @@ namespace direct_bt {
             bool hasIOError() const noexcept { return has_ioerror; }
             std::string getStateString() const noexcept override { return L2CAPComm::getStateString(is_open_, interrupted_int(), interrupted_ext(), has_ioerror); }
 
+            /**
+             * Returns a snapshot of this channel's L2CAPStats, counted since its last open or resetStats().
+             * @since 2.7.0
+             */
+            L2CAPStats getStats() const noexcept;
+
+            /**
+             * Clears this channel's L2CAPStats, also done on each open() and openAsync().
+             * @since 2.7.0
+             */
+            void resetStats() noexcept;
+
             /** Return the recursive write mutex for multithreading access. */
             std::recursive_mutex & mutex_write() noexcept { return mtx_write; }
 
@@ -284,13 +501,46 @@ namespace direct_bt {
              */
             BTSecurityLevel getBTSecurityLevel() noexcept;
 
+            /**
+             * Returns the transmit MTU (SDU size) of this connected LE CoC channel via the `BT_SNDMTU` socket option,
+             * i.e. the MTU announced by the remote device.
+             * <p>
+             * A single write() shall not exceed this size, as one write() is sent as one SDU.
+             * The kernel segments each SDU into PDUs of the negotiated MPS
+             * and paces them via the remote's credits.
+             * </p>
+             * <p>
+             * BT Core Spec v5.2: Vol 3, Part A: 10.1 LE Credit Based Flow Control Mode
+             * </p>
+             * <p>
+             * An L2CAPLoopback channel returns its emulated MTU.
+             * </p>
+             * @return the transmit MTU or zero if not open, not an LE CoC channel or on failure
+             */
+            uint16_t getTxMTU() const noexcept;
+
             /**
              * Generic read, w/o locking suitable for a unique ringbuffer sink. Using L2CAPEnv::L2CAP_READER_POLL_TIMEOUT.
              * @param buffer
              * @param capacity
              * @return number of bytes read if >= 0, otherwise L2CAPComm::ExitCode error code.
              */
-            jau::snsize_t read(uint8_t* buffer, const jau::nsize_t capacity) noexcept;
+            jau::snsize_t read(uint8_t* buffer, const jau::nsize_t capacity) noexcept {
+                return read(buffer, capacity, env.L2CAP_READER_POLL_TIMEOUT);
+            }
+
+            /**
+             * Generic read w/ own poll timeout, w/o locking suitable for a unique ringbuffer sink.
+             * <p>
+             * Blocks until data arrives, the timeout occurs or until woken up via wakeup(),
+             * where the latter two return RWExitCode::POLL_TIMEOUT if not interrupted().
+             * </p>
+             * @param buffer
+             * @param capacity
+             * @param timeoutMS poll timeout in milliseconds, zero or negative blocks indefinitely
+             * @return number of bytes read if >= 0, otherwise L2CAPComm::ExitCode error code.
+             */
+            jau::snsize_t read(uint8_t* buffer, const jau::nsize_t capacity, const int32_t timeoutMS) noexcept;
 
             /**
              * Generic write, locking {@link #mutex_write()}.
@@ -300,18 +550,235 @@ namespace direct_bt {
              */
             jau::snsize_t write(const uint8_t *buffer, const jau::nsize_t length) noexcept;
 
+            /**
+             * Generic scatter-gather write of a header and a payload buffer as one packet via `writev()`, locking {@link #mutex_write()}.
+             * <p>
+             * Allows sending a shared payload without copying it into a contiguous packet buffer first.
+             * </p>
+             * @param header
+             * @param header_length
+             * @param payload may be nullptr if payload_length is zero
+             * @param payload_length
+             * @return number of bytes written if >= 0, otherwise L2CAPComm::ExitCode error code.
+             */
+            jau::snsize_t writev(const uint8_t *header, const jau::nsize_t header_length,
+                                 const uint8_t *payload, const jau::nsize_t payload_length) noexcept;
+
+            /**
+             * Non-blocking write of a header and a payload buffer as one packet, never blocking on {@link #mutex_write()}.
+             * <p>
+             * The packet is sent immediately if {@link #mutex_write()} is available and the socket's send queue allows,
+             * otherwise it is copied into this channel's bounded send queue of L2CAPEnv::L2CAP_SEND_QUEUE_CAPACITY packets.
+             * Pending packets are sent in order ahead of any new packet, including those of write() and writev().
+             * </p>
+             * <p>
+             * The send queue is flushed by subsequent writes, by flushQueued()
+             * and by read() once poll() signals the socket writable, i.e. readiness driven by the reader thread.
+             * A writer holding {@link #mutex_write()} flushes the queue itself and wakes up the reader for any remainder.
+             * </p>
+             * <p>
+             * Hence a slow peer won't stall the calling thread, e.g. the GATT reader sending an indication confirmation.
+             * </p>
+             * @param header
+             * @param header_length
+             * @param payload may be nullptr if payload_length is zero
+             * @param payload_length
+             * @return number of bytes sent or queued if >= 0,
+             *         RWExitCode::QUEUE_FULL if the send queue is exhausted as backpressure signal to the caller,
+             *         otherwise L2CAPComm::ExitCode error code.
+             * @see getSendQueueSize()
+             * @see flushQueued()
+             */
+            jau::snsize_t writeQueued(const uint8_t *header, const jau::nsize_t header_length,
+                                      const uint8_t *payload, const jau::nsize_t payload_length) noexcept;
+
+            /**
+             * Non-blocking flush of the send queue, locking {@link #mutex_write()}.
+             * @return number of remaining queued packets if >= 0, otherwise L2CAPComm::ExitCode error code.
+             * @see writeQueued()
+             */
+            jau::snsize_t flushQueued() noexcept;
+
+            /** Returns the number of packets pending in the send queue, see writeQueued(). */
+            jau::nsize_t getSendQueueSize() const noexcept { return send_queue_size; }
+
+            /**
+             * Returns the free space of the socket's send queue in bytes,
+             * as reported by the Linux Bluetooth socket `TIOCOUTQ` (aka `SIOCOUTQ`) ioctl.
+             * <p>
+             * Note: Other than for inet sockets, Linux Bluetooth sockets report `SO_SNDBUF - allocated`,
+             * i.e. the remaining space and not the queued bytes.
+             * </p>
+             * <p>
+             * The send queue drains as the controller returns its ACL buffer credits to the kernel,
+             * hence the remaining space reflects the link's flow control state.
+             * </p>
+             * @return free send queue space in bytes if >= 0, otherwise L2CAPComm::ExitCode error code.
+             */
+            jau::snsize_t getTxQueueSpace() noexcept;
+
+            /**
+             * Blocks until the socket's send queue has drained enough to be writable or the given timeout occurs.
+             * <p>
+             * The Linux Bluetooth socket signals writable once its send queue is filled less than half of `SO_SNDBUF`.
+             * </p>
+             * @param timeout maximum duration to wait
+             * @return zero if writable, otherwise L2CAPComm::ExitCode error code, e.g. RWExitCode::POLL_TIMEOUT.
+             */
+            jau::snsize_t waitWritable(const jau::fraction_i64& timeout) noexcept;
+
             std::string toString() const noexcept override;
     };
 
+    /**
+     * Shared scheduler driving the non-blocking connect of many L2CAPClient instances, see L2CAPClient::openAsync().
+     * <p>
+     * A single worker thread poll()s all connecting sockets for writability up to their deadline,
+     * hence many devices' L2CAP channels are set up concurrently with bounded thread usage.
+     * The worker thread is started on demand and ends once no connect is pending.
+     * </p>
+     */
+    class L2CAPConnectScheduler {
+        private:
+            struct Pending {
+                L2CAPClient* client;
+                L2CAPClient::connect_callback_t cb;
+            };
+            std::mutex mtx_pending;
+            std::condition_variable cv_pending;
+            jau::darray<Pending> pending;
+            /** Client being progressed by the worker, protected by mtx_pending */
+            L2CAPClient* in_progress;
+            bool running;
+            std::thread::id worker_id;
+            /** Self-pipe to interrupt the worker's poll() on added clients */
+            int wakeup_fd[2];
+
+            L2CAPConnectScheduler() noexcept;
+
+            void worker() noexcept;
+
+        public:
+            static L2CAPConnectScheduler& get() noexcept {
+                /**
+                 * Thread safe starting with C++11 6.7, see L2CAPEnv::get().
+                 */
+                static L2CAPConnectScheduler s;
+                return s;
+            }
+
+            ~L2CAPConnectScheduler() noexcept;
+
+            L2CAPConnectScheduler(const L2CAPConnectScheduler&) = delete;
+            void operator=(const L2CAPConnectScheduler&) = delete;
+
+            /**
+             * Adds the given L2CAPClient with its connect in progress, starting the worker thread if required.
+             * @return true if added, otherwise false
+             */
+            bool add(L2CAPClient& client, const L2CAPClient::connect_callback_t& cb) noexcept;
+
+            /**
+             * Removes the given L2CAPClient if pending, invoking its callback with `connected` false.
+             * <p>
+             * Waits until the worker has finished progressing the given client, unless called by the worker itself.
+             * </p>
+             * @return true if the client was pending, otherwise false
+             */
+            bool remove(L2CAPClient& client) noexcept;
+
+            /** Returns the number of pending connects. */
+            jau::nsize_t getPendingCount() noexcept;
+    };
+
+    /**
+     * In-memory raw channel loopback of two connected L2CAPClient instances, not requiring any Bluetooth adapter.
+     * <p>
+     * Both channels use `AF_UNIX` `SOCK_SEQPACKET` sockets, preserving packet boundaries like an L2CAP socket,
+     * hence all L2CAPClient read, write and wakeup code paths are exercised unchanged.
+     * Allows deterministic exchange of raw PDUs, e.g. ATT or SMP, for unit tests and microbenchmarks of the channel.
+     * </p>
+     * <p>
+     * It does not provide a GATT peer: BTGattHandler and its DBGattServerHandler require a BTDevice of a BTAdapter,
+     * hence the PDUs are produced and consumed by the test itself.
+     * </p>
+     * <p>
+     * A write exceeding the emulated MTU fails with `EMSGSIZE` like the kernel's L2CAP socket,
+     * see L2CAPClient::getTxMTU().
+     * A non-zero latency delays each packet by a relay thread, preserving the packet order.
+     * Closing one channel lets the other channel's read return zero bytes, i.e. end of stream,
+     * after all its pending packets have been delivered.
+     * </p>
+     * <p>
+     * Setting the BTSecurityLevel, the LE CoC rx_mtu or the L2CAPIOProfile is not supported.
+     * </p>
+     * @since 2.7.0
+     */
+    class L2CAPLoopback {
+        private:
+            struct Packet {
+                uint64_t due_us;
+                jau::POctets data;
+            };
+            const uint16_t mtu;
+            const uint64_t latency_us;
+            std::unique_ptr<L2CAPClient> channel[2];
+            /** Relay side of each channel's socketpair, only used with a non-zero latency */
+            int relay_fd[2];
+            /** eventfd to stop the relay thread */
+            int stop_fd;
+            std::thread relay;
+
+            void relayWork() noexcept;
+
+        public:
+            /**
+             * Constructs and connects the loopback channels.
+             * @param mtu the emulated MTU of both channels, defaults to L2CAPComm::LE_COC_MIN_MTU
+             * @param latency the delay of each packet, defaults to zero not using a relay thread
+             * @see isOpen()
+             */
+            L2CAPLoopback(const uint16_t mtu=L2CAPComm::LE_COC_MIN_MTU, const jau::fraction_i64& latency=jau::fractions_i64::zero) noexcept;
+
+            /** Destructor closing both channels and stopping the relay thread. */
+            ~L2CAPLoopback() noexcept;
+
+            L2CAPLoopback(const L2CAPLoopback&) = delete;
+            void operator=(const L2CAPLoopback&) = delete;
+
+            /** Returns true if both channels have been connected successfully. */
+            bool isOpen() const noexcept { return channel[0]->is_open() && channel[1]->is_open(); }
+
+            /** Returns the emulated MTU of both channels. */
+            uint16_t getMTU() const noexcept { return mtu; }
+
+            /** Returns the first channel, e.g. acting as the GATT client. */
+            L2CAPClient& first() noexcept { return *channel[0]; }
+
+            /** Returns the second channel, e.g. acting as the GATT server. */
+            L2CAPClient& second() noexcept { return *channel[1]; }
+
+            std::string toString() const noexcept;
+    };
+
     /**
      * L2CAP server socket to listen for connecting remote devices
      */
     class L2CAPServer : public L2CAPComm {
         private:
-            std::atomic<pthread_t> tid_accept;
+            std::unique_ptr<L2CAPClient> acceptImpl(const int timeoutMS) noexcept;
 
         public:
-            L2CAPServer(const uint16_t adev_id, const BDAddressAndType& localAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid) noexcept;
+            /**
+             * Constructing a non open L2CAP server instance for the pre-defined PSM and CID.
+             * <p>
+             * An LE CoC server is selected by L2CAP_CID::UNDEFINED and a valid LE SPSM, see is_LE_SPSM(),
+             * or L2CAP_PSM::UNDEFINED to have the kernel allocate a dynamic LE PSM, see getBoundPSM().
+             * The given rx_mtu is requested if not zero and inherited by all accepted channels.
+             * </p>
+             */
+            L2CAPServer(const uint16_t adev_id, const BDAddressAndType& localAddressAndType, const L2CAP_PSM psm, const L2CAP_CID cid,
+                        const uint16_t rx_mtu=0) noexcept;
 
             /** Destructor closing the L2CAP channel, see {@link #close()}. */
             ~L2CAPServer() noexcept { close(); }
@@ -320,8 +787,23 @@ namespace direct_bt {
 
             bool close() noexcept override;
 
+            /**
+             * Blocks until a connection is pending or this server gets interrupted, then accepts it.
+             * @return the accepted L2CAPClient or nullptr on failure or interruption
+             */
             std::unique_ptr<L2CAPClient> accept() noexcept;
 
+            /**
+             * Accepts an already pending connection without blocking.
+             * <p>
+             * Allows draining all connections queued within the listen backlog after accept() returned,
+             * see L2CAPEnv::L2CAP_LISTEN_BACKLOG.
+             * </p>
+             * @return the accepted L2CAPClient or nullptr if none is pending or on failure
+             * @since 2.7.0
+             */
+            std::unique_ptr<L2CAPClient> acceptPending() noexcept;
+
             std::string getStateString() const noexcept override { return L2CAPComm::getStateString(is_open_, interrupted_int(), interrupted_ext(), false /* has_ioerror */); }
 
             std::string toString() const noexcept override;
@@ -294,10 +294,7 @@ class NativeGattToServerCharListener : public BTGattHandler::NativeGattCharListe
         fprintf_td(stderr, "    raw : %s\n", char_value.toString().c_str());
         fprintf_td(stderr, "    utf8: %s\n", jau::dfa_utf8_decode(char_value.get_ptr(), char_value.size()).c_str());
         fprintf_td(stderr, "\n");
-        std::shared_ptr<BTGattHandler> gh = nullptr != devToClient ? devToClient->getGattHandler() : nullptr;
-        if( nullptr != gh ) {
-            gh->sendNotification(char_handle, char_value);
-        }
+        // forwarded to the client by the pipelined DBGattServer, see startAdvertisingToClient()
     }
 
     void indicationReceived(BTDeviceRef source, const uint16_t char_handle,
@@ -314,10 +311,7 @@ class NativeGattToServerCharListener : public BTGattHandler::NativeGattCharListe
         fprintf_td(stderr, "    raw : %s\n", char_value.toString().c_str());
         fprintf_td(stderr, "    utf8: %s\n", jau::dfa_utf8_decode(char_value.get_ptr(), char_value.size()).c_str());
         fprintf_td(stderr, "\n");
-        std::shared_ptr<BTGattHandler> gh = nullptr != devToClient ? devToClient->getGattHandler() : nullptr;
-        if( nullptr != gh ) {
-            gh->sendIndication(char_handle, char_value);
-        }
+        // forwarded to the client by the pipelined DBGattServer, see startAdvertisingToClient()
     }
 
     void mtuResponse(const uint16_t clientMTU,
@@ -734,7 +728,8 @@ static bool startAdvertisingToClient(BTAdapterRef a, std::string msg) {
     const EIRDataType ind_mask = EIR_DATA_TYPE_MASK & devToServer->getEIRInd()->getEIRDataMask();
     const EIRDataType scanrsp_mask = EIR_DATA_TYPE_MASK & devToServer->getEIRScanRsp()->getEIRDataMask();
 
-    DBGattServerRef dbGattServer( new DBGattServer( devToServer ) );
+    // Pipelined: Discovery answered locally, notifications and indications streamed and write commands forwarded asynchronously
+    DBGattServerRef dbGattServer( new DBGattServer( devToServer, true /* fwdPipelined */ ) );
     fprintf_td(stderr, "To Client: Start advertising: GattServer %s\n", dbGattServer->toString().c_str());
 
     DBGattCharRef gattDevNameChar = dbGattServer->findGattChar( jau::uuid16_t(GattServiceType::GENERIC_ACCESS),
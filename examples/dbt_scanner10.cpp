@@ -530,6 +530,7 @@ static void processReadyDevice(BTDeviceRef device) {
                         }
                     }
                 }
+                serviceChar->ensureDescriptorsDiscovered();
                 jau::darray<BTGattDescRef> & charDescList = serviceChar->descriptorList;
                 for(size_t k=0; k<charDescList.size(); k++) {
                     BTGattDesc & charDesc = *charDescList.at(k);
@@ -26,12 +26,15 @@
 package jau.direct_bt;
 
 import java.lang.ref.WeakReference;
+import java.util.Collections;
 import java.util.List;
 
 import org.direct_bt.BTException;
 import org.direct_bt.BTGattChar;
 import org.direct_bt.BTGattDesc;
 import org.direct_bt.BTGattService;
+import org.direct_bt.BTUtils;
+import org.direct_bt.DBGattDesc;
 import org.direct_bt.GattCharPropertySet;
 import org.jau.util.BasicTypes;
 import org.direct_bt.BTGattCharListener;
@@ -64,22 +67,24 @@ public class DBTGattChar extends DBTObject implements BTGattChar
      */
     private final short value_handle;
 
+    private static final String CCC_DESC_UUID128 = BTUtils.toUUID128(DBGattDesc.UUID16.CCC_DESC);
+    private static final String USER_DESC_UUID128 = BTUtils.toUUID128(DBGattDesc.UUID16.USER_DESC);
+
     /* Optional Client Characteristic Configuration index within descriptorList */
-    private final int clientCharacteristicsConfigIndex;
+    private int clientCharacteristicsConfigIndex = -1;
 
     /* Optional Characteristic User Description index within descriptorList */
-    private final int userDescriptionIndex;
+    private int userDescriptionIndex = -1;
 
-    /* pp */ final List<BTGattDesc> descriptorList;
+    /** Descriptor list, retrieved on first access, see {@link #getDescriptorList()}. */
+    private List<BTGattDesc> descriptorList = null;
 
     boolean enabledNotifyState = false;
     boolean enabledIndicateState = false;
 
    /* pp */ DBTGattChar(final long nativeInstance, final DBTGattService service,
                         final short handle, final GattCharPropertySet properties,
-                        final String value_type_uuid, final short value_handle,
-                        final int clientCharacteristicsConfigIndex,
-                        final int userDescriptionIndex)
+                        final String value_type_uuid, final short value_handle)
     {
         super(nativeInstance, handle /* hash */);
         this.wbr_service = new WeakReference<DBTGattService>(service);
@@ -88,9 +93,6 @@ public class DBTGattChar extends DBTObject implements BTGattChar
         this.properties = properties;
         this.value_type_uuid = value_type_uuid;
         this.value_handle = value_handle;
-        this.clientCharacteristicsConfigIndex = clientCharacteristicsConfigIndex;
-        this.userDescriptionIndex = userDescriptionIndex;
-        this.descriptorList = getDescriptorsImpl();
 
         if( DEBUG ) {
             final boolean hasNotify = properties.isSet(GattCharPropertySet.Type.Notify);
@@ -115,6 +117,36 @@ public class DBTGattChar extends DBTObject implements BTGattChar
             }
         }
     }
+
+    /**
+     * Returns the descriptor list, retrieved with its first successful call.
+     * <p>
+     * The native descriptors may be discovered on demand at this point,
+     * see BTGattChar::ensureDescriptorsDiscovered() and BTGattEnv::GATT_LAZY_DESCRIPTOR_DISCOVERY.
+     * The Client Characteristic Configuration and User Description indices are derived from the retrieved list.
+     * </p>
+     * @return the descriptor list, empty if not yet discoverable
+     */
+    /* pp */ final synchronized List<BTGattDesc> getDescriptorList() {
+        if( null == descriptorList ) {
+            final List<BTGattDesc> list = getDescriptorsImpl();
+            if( null == list ) {
+                return Collections.emptyList(); // retry w/ next call
+            }
+            final int size = list.size();
+            for(int i = 0; i < size; i++ ) {
+                final String uuid = list.get(i).getUUID();
+                if( 0 > clientCharacteristicsConfigIndex && CCC_DESC_UUID128.equalsIgnoreCase(uuid) ) {
+                    clientCharacteristicsConfigIndex = i;
+                } else if( 0 > userDescriptionIndex && USER_DESC_UUID128.equalsIgnoreCase(uuid) ) {
+                    userDescriptionIndex = i;
+                }
+            }
+            descriptorList = list;
+        }
+        return descriptorList;
+    }
+    /** Returns null if the descriptors could not be discovered. */
     private native List<BTGattDesc> getDescriptorsImpl();
 
     @Override
@@ -152,9 +184,10 @@ public class DBTGattChar extends DBTObject implements BTGattChar
         if( null == device ) {
             return null;
         }
-        final int size = descriptorList.size();
+        final List<BTGattDesc> list = getDescriptorList();
+        final int size = list.size();
         for(int i = 0; i < size; i++ ) {
-            final DBTGattDesc descr = (DBTGattDesc) descriptorList.get(i);
+            final DBTGattDesc descr = (DBTGattDesc) list.get(i);
             if( descr.getUUID().equals(desc_uuid) ) {
                 return descr;
             }
@@ -176,7 +209,7 @@ public class DBTGattChar extends DBTObject implements BTGattChar
     public final GattCharPropertySet getProperties() { return properties; }
 
     @Override
-    public final List<BTGattDesc> getDescriptors() { return descriptorList; }
+    public final List<BTGattDesc> getDescriptors() { return getDescriptorList(); }
 
     @Override
     public final synchronized boolean configNotificationIndication(final boolean enableNotification, final boolean enableIndication, final boolean enabledState[/*2*/])
@@ -286,19 +319,21 @@ public class DBTGattChar extends DBTObject implements BTGattChar
     public final short getValueHandle() { return value_handle; }
 
     @Override
-    public final BTGattDesc getClientCharConfig() {
+    public final synchronized BTGattDesc getClientCharConfig() {
+        final List<BTGattDesc> list = getDescriptorList();
         if( 0 > clientCharacteristicsConfigIndex ) {
             return null;
         }
-        return descriptorList.get(clientCharacteristicsConfigIndex); // exception if out of bounds
+        return list.get(clientCharacteristicsConfigIndex); // exception if out of bounds
     }
 
     @Override
-    public final BTGattDesc getUserDescription() {
+    public final synchronized BTGattDesc getUserDescription() {
+        final List<BTGattDesc> list = getDescriptorList();
         if( 0 > userDescriptionIndex ) {
             return null;
         }
-        return descriptorList.get(userDescriptionIndex); // exception if out of bounds
+        return list.get(userDescriptionIndex); // exception if out of bounds
     }
 
     @Override
@@ -69,6 +69,9 @@ jobject Java_jau_direct_1bt_DBTGattChar_getDescriptorsImpl(JNIEnv *env, jobject
         JavaAnonRef characteristic_java = characteristic->getJavaObject(); // hold until done!
         JavaGlobalObj::check(characteristic_java, E_FILE_LINE);
 
+        if( !characteristic->ensureDescriptorsDiscovered() ) {
+            return nullptr; // Java side retries on next access
+        }
         jau::darray<BTGattDescRef> & descriptorList = characteristic->descriptorList;
 
         // BTGattDesc(final long nativeInstance, final BTGattChar characteristic,
@@ -64,7 +64,7 @@ jstring Java_jau_direct_1bt_DBTGattService_toStringImpl(JNIEnv *env, jobject obj
 }
 
 
-static const std::string _characteristicClazzCtorArgs("(JLjau/direct_bt/DBTGattService;SLorg/direct_bt/GattCharPropertySet;Ljava/lang/String;SII)V");
+static const std::string _characteristicClazzCtorArgs("(JLjau/direct_bt/DBTGattService;SLorg/direct_bt/GattCharPropertySet;Ljava/lang/String;S)V");
 static const std::string _gattCharPropSetClassName("org/direct_bt/GattCharPropertySet");
 static const std::string _gattCharPropSetClazzCtorArgs("(B)V");
 
@@ -95,9 +95,7 @@ jobject Java_jau_direct_1bt_DBTGattService_getCharsImpl(JNIEnv *env, jobject obj
         /**
             DBTGattChar(final long nativeInstance, final DBTGattService service,
                         final short handle, final GattCharPropertySet properties,
-                        final String value_type_uuid, final short value_handle,
-                        final int clientCharacteristicsConfigIndex,
-                        final int userDescriptionIndex)
+                        final String value_type_uuid, final short value_handle)
         */
         std::function<jobject(JNIEnv*, jclass, jmethodID, const BTGattCharRef&)> ctor_char =
                 [&gattCharPropSetClazz, &gattCharPropSetClazzCtor](JNIEnv *env_, jclass clazz, jmethodID clazz_ctor, const BTGattCharRef& characteristic)->jobject {
@@ -122,9 +120,7 @@ jobject Java_jau_direct_1bt_DBTGattService_getCharsImpl(JNIEnv *env, jobject obj
                     shared_ptr_ref<BTGattChar> characteristic_sref(characteristic); // new instance to be released into new jobject
                     jobject jcharVal = env_->NewObject(clazz, clazz_ctor, characteristic_sref.release_to_jlong(), jservice,
                             characteristic->handle, jGattCharPropSet,
-                            uuid, characteristic->value_handle,
-                            characteristic->clientCharConfigIndex,
-                            characteristic->userDescriptionIndex);
+                            uuid, characteristic->value_handle);
                     java_exception_check_and_throw(env_, E_FILE_LINE);
                     JNIGlobalRef::check(jcharVal, E_FILE_LINE);
                     JavaAnonRef jCharRef = characteristic->getJavaObject(); // GlobalRef
@@ -52,6 +52,9 @@ extern "C" {
 using namespace direct_bt;
 using namespace jau::fractions_i64_literals;
 
+/** The BTAdapter whose L2CAP setup pool runs the current thread, see BTAdapter::l2capSetupWorker(). */
+static thread_local const BTAdapter* l2cap_setup_worker_adapter = nullptr;
+
 constexpr static const bool _print_device_lists = false;
 
 std::string direct_bt::to_string(const DiscoveryPolicy v) noexcept {
@@ -242,6 +245,30 @@ int BTAdapter::getConnectedDeviceCount() const noexcept {
     return connectedDevices.size();
 }
 
+void BTAdapter::addClosedL2CAPStats(const L2CAPStats& s) noexcept {
+    const std::lock_guard<std::mutex> lock(mtx_l2cap_stats); // RAII-style acquire and relinquish via destructor
+    l2cap_stats_closed += s;
+}
+
+L2CAPStats BTAdapter::getL2CAPStats() const noexcept {
+    device_list_t devices;
+    {
+        const std::lock_guard<std::mutex> lock(mtx_connectedDevices); // RAII-style acquire and relinquish via destructor
+        devices = connectedDevices; // copy!
+    }
+    L2CAPStats res;
+    {
+        const std::lock_guard<std::mutex> lock(mtx_l2cap_stats); // RAII-style acquire and relinquish via destructor
+        res = l2cap_stats_closed;
+    }
+    for(const BTDeviceRef& device : devices) {
+        if( nullptr != device ) {
+            res += device->getL2CAPStats();
+        }
+    }
+    return res;
+}
+
 // *************************************************
 // *************************************************
 // *************************************************
@@ -395,7 +422,9 @@ BTAdapter::BTAdapter(const BTAdapter::ctor_cookie& cc, const BTManagerRef& mgmt_
   l2cap_service("BTAdapter::l2capServer", THREAD_SHUTDOWN_TIMEOUT_MS,
                 jau::bindMemberFunc(this, &BTAdapter::l2capServerWork),
                 jau::bindMemberFunc(this, &BTAdapter::l2capServerInit),
-                jau::bindMemberFunc(this, &BTAdapter::l2capServerEnd))
+                jau::bindMemberFunc(this, &BTAdapter::l2capServerEnd)),
+  l2cap_setup_workers(0),
+  l2cap_setup_closing(false)
 {
     (void)cc;
 
@@ -451,8 +480,11 @@ void BTAdapter::close() noexcept {
 
     DBG_PRINT("BTAdapter::close: close[HCI, l2cap_srv]: ...");
     hci.close();
+    l2cap_service.set_shall_stop();
+    l2cap_att_srv.wakeup(); // interrupt blocking accept()
     l2cap_service.stop();
     l2cap_att_srv.close();
+    clearL2CAPSetup();
     DBG_PRINT("BTAdapter::close: close[HCI, l2cap_srv]: XXX");
 
     {
@@ -698,6 +730,10 @@ HCIStatusCode BTAdapter::uploadKeys(SMPKeyBin& bin, const bool write) noexcept {
 HCIStatusCode BTAdapter::initialize(const BTMode btMode) noexcept {
     const bool was_powered = adapterInfo.isCurrentSettingBitSet(AdapterSetting::POWERED);
     adapter_initialized = true;
+    {
+        std::unique_lock<std::mutex> lock(mtx_l2cap_setup); // RAII-style acquire and relinquish via destructor
+        l2cap_setup_closing = false; // accept L2CAP setup jobs again after a previous close()
+    }
 
     // Also fails if unable to power-on and not powered-on!
     HCIStatusCode status = mgmt->initializeAdapter(adapterInfo, dev_id, BTRole::None /* unused */, btMode);
@@ -885,6 +921,31 @@ HCIStatusCode BTAdapter::setDefaultLE_PHY(const LE_PHYs Tx, const LE_PHYs Rx) no
     return hci.le_set_default_phy(Tx, Rx);
 }
 
+std::unique_ptr<L2CAPServer> BTAdapter::openL2CAPServer(const L2CAP_PSM psm, const uint16_t rx_mtu, const L2CAPIOProfile io_profile) noexcept {
+    if( !isPowered() ) { // isValid() && hci.isOpen() && POWERED
+        poweredOff(false /* active */);
+        return nullptr;
+    }
+    if( L2CAP_PSM::UNDEFINED != psm && !is_LE_SPSM(psm) ) {
+        ERR_PRINT("Invalid LE SPSM: dev_id %d, psm %s", dev_id, to_string(psm).c_str());
+        return nullptr;
+    }
+    if( 0 < rx_mtu && L2CAPComm::LE_COC_MIN_MTU > rx_mtu ) {
+        ERR_PRINT("Invalid rx_mtu %u < %u: dev_id %d, psm %s", rx_mtu, L2CAPComm::LE_COC_MIN_MTU, dev_id, to_string(psm).c_str());
+        return nullptr;
+    }
+    std::unique_ptr<L2CAPServer> l2cap = std::make_unique<L2CAPServer>(dev_id, getAddressAndType(), psm, L2CAP_CID::UNDEFINED, rx_mtu);
+    l2cap->setIOProfile(io_profile);
+    if( !l2cap->open() ) {
+        ERR_PRINT("Open failed: dev_id %d, psm %s, rx_mtu %u", dev_id, to_string(psm).c_str(), rx_mtu);
+        return nullptr;
+    }
+    DBG_PRINT("BTAdapter::openL2CAPServer: dev_id %d, psm %s -> %s, rx_mtu %u, io %s, %s",
+              dev_id, to_string(psm).c_str(), to_string(l2cap->getBoundPSM()).c_str(), l2cap->getRxMTU(),
+              to_string(io_profile).c_str(), l2cap->toString().c_str());
+    return l2cap;
+}
+
 bool BTAdapter::isDeviceWhitelisted(const BDAddressAndType & addressAndType) noexcept {
     return mgmt->isDeviceWhitelisted(dev_id, addressAndType);
 }
@@ -1073,6 +1134,8 @@ HCIStatusCode BTAdapter::startDiscovery(const DiscoveryPolicy policy, const bool
         return HCIStatusCode::COMMAND_DISALLOWED;
     }
 
+    l2cap_service.set_shall_stop();
+    l2cap_att_srv.wakeup(); // interrupt blocking accept()
     l2cap_service.stop();
 
     removeDiscoveredDevices();
@@ -1496,6 +1559,8 @@ HCIStatusCode BTAdapter::startAdvertising(DBGattServerRef gattServerData_,
                                             adv_interval_min, adv_interval_max, adv_type, adv_chan_map, filter_policy);
     if( HCIStatusCode::SUCCESS != status ) {
         ERR_PRINT("le_start_adv failed: %s - %s", to_string(status).c_str(), toString(true).c_str());
+        l2cap_service.set_shall_stop();
+        l2cap_att_srv.wakeup(); // interrupt blocking accept()
         l2cap_service.stop();
     } else {
         gattServerData = gattServerData_;
@@ -1544,6 +1609,8 @@ HCIStatusCode BTAdapter::stopAdvertising() noexcept {
         return HCIStatusCode::NOT_POWERED;
     }
 
+    l2cap_service.set_shall_stop();
+    l2cap_att_srv.wakeup(); // interrupt blocking accept()
     l2cap_service.stop();
 
     HCIStatusCode status = hci.le_enable_adv(false /* enable */);
@@ -1807,23 +1874,49 @@ void BTAdapter::l2capServerEnd(jau::service_runner& sr) {
     if( !l2cap_att_srv.close() ) {
         ERR_PRINT("Adapter[%d]: L2CAP ATT close failed: %s", dev_id, l2cap_att_srv.toString().c_str());
     }
+    {
+        std::unique_lock<std::mutex> lock(mtx_l2cap_att); // RAII-style acquire and relinquish via destructor
+        l2cap_att_queue.clear();
+    }
+    cv_l2cap_att.notify_all(); // notify waiting getter
 }
 
 void BTAdapter::l2capServerWork(jau::service_runner& sr) {
-    (void)sr;
     std::unique_ptr<L2CAPClient> l2cap_att_ = l2cap_att_srv.accept();
-    if( BTRole::Slave == getRole() && nullptr != l2cap_att_ ) {
+    if( nullptr == l2cap_att_ ) {
+        DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer connected.0: nullptr");
+        return;
+    }
+    // drain all connections pending within the listen backlog before blocking again
+    int count = 0;
+    while( nullptr != l2cap_att_ ) {
+        ++count;
+        l2capServerQueue( std::move(l2cap_att_) );
+        if( sr.shall_stop() ) {
+            break;
+        }
+        l2cap_att_ = l2cap_att_srv.acceptPending();
+    }
+    DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer accepted %d", count);
+}
+
+void BTAdapter::l2capServerQueue(std::unique_ptr<L2CAPClient> l2cap_att_) noexcept {
+    if( BTRole::Slave == getRole() ) {
         DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer connected.1: %s", l2cap_att_->toString().c_str());
 
         std::unique_lock<std::mutex> lock(mtx_l2cap_att); // RAII-style acquire and relinquish via destructor
-        l2cap_att = std::move( l2cap_att_ );
+        const BDAddressAndType remoteAddressAndType = l2cap_att_->getRemoteAddressAndType();
+        std::unique_ptr<L2CAPClient>& slot = l2cap_att_queue[remoteAddressAndType];
+        if( nullptr != slot ) {
+            DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer replacing unclaimed: %s", slot->toString().c_str());
+        }
+        slot = std::move( l2cap_att_ );
+        const jau::nsize_t queue_size = l2cap_att_queue.size();
         lock.unlock(); // unlock mutex before notify_all to avoid pessimistic re-block of notified wait() thread.
         cv_l2cap_att.notify_all(); // notify waiting getter
-
-    } else if( nullptr != l2cap_att_ ) {
-        DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer connected.2: %s", l2cap_att_->toString().c_str());
+        DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer queued %zu", (size_t)queue_size);
     } else {
-        DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer connected.0: nullptr");
+        DBG_PRINT("L2CAP-ACCEPT: BTAdapter::l2capServer connected.2: %s", l2cap_att_->toString().c_str());
     }
 }
 
@@ -1834,16 +1927,20 @@ std::unique_ptr<L2CAPClient> BTAdapter::get_l2cap_connection(std::shared_ptr<BTD
 
         std::unique_lock<std::mutex> lock(mtx_l2cap_att); // RAII-style acquire and relinquish via destructor
         const jau::fraction_timespec timeout_time = jau::getMonotonicTime() + jau::fraction_timespec(timeout);
-        while( device->getConnected() && ( nullptr == l2cap_att || l2cap_att->getRemoteAddressAndType() != clientAddrAndType ) ) {
+        auto it = l2cap_att_queue.find(clientAddrAndType);
+        while( device->getConnected() && !l2cap_setup_closing && l2cap_att_queue.end() == it ) {
             std::cv_status s = wait_until(cv_l2cap_att, lock, timeout_time);
-            if( std::cv_status::timeout == s && ( nullptr == l2cap_att || l2cap_att->getRemoteAddressAndType() != clientAddrAndType ) ) {
+            it = l2cap_att_queue.find(clientAddrAndType);
+            if( std::cv_status::timeout == s && l2cap_att_queue.end() == it ) {
                 DBG_PRINT("L2CAP-ACCEPT: BTAdapter:get_l2cap_connection(dev_id %d): l2cap_att TIMEOUT", dev_id);
                 return nullptr;
             }
         }
-        if( nullptr != l2cap_att ) {
-            std::unique_ptr<L2CAPClient> l2cap_att_ = std::move( l2cap_att );
-            DBG_PRINT("L2CAP-ACCEPT: BTAdapter:get_l2cap_connection(dev_id %d): l2cap_att %s", dev_id, l2cap_att_->toString().c_str());
+        if( l2cap_att_queue.end() != it ) {
+            std::unique_ptr<L2CAPClient> l2cap_att_ = std::move( it->second );
+            l2cap_att_queue.erase(it);
+            DBG_PRINT("L2CAP-ACCEPT: BTAdapter:get_l2cap_connection(dev_id %d): l2cap_att %s, %zu queued",
+                    dev_id, l2cap_att_->toString().c_str(), (size_t)l2cap_att_queue.size());
             return l2cap_att_; // copy elision
         } else {
             DBG_PRINT("L2CAP-ACCEPT: BTAdapter:get_l2cap_connection(dev_id %d): Might got disconnected", dev_id);
@@ -1855,6 +1952,121 @@ std::unique_ptr<L2CAPClient> BTAdapter::get_l2cap_connection(std::shared_ptr<BTD
     }
 }
 
+void BTAdapter::drop_l2cap_connection(const BDAddressAndType& addressAndType) noexcept {
+    std::unique_ptr<L2CAPClient> l2cap_att_;
+    {
+        std::unique_lock<std::mutex> lock(mtx_l2cap_att); // RAII-style acquire and relinquish via destructor
+        auto it = l2cap_att_queue.find(addressAndType);
+        if( l2cap_att_queue.end() != it ) {
+            l2cap_att_ = std::move( it->second );
+            l2cap_att_queue.erase(it);
+        }
+    }
+    cv_l2cap_att.notify_all(); // notify waiting getter of disconnect
+    if( nullptr != l2cap_att_ ) {
+        DBG_PRINT("L2CAP-ACCEPT: BTAdapter:drop_l2cap_connection(dev_id %d): unclaimed %s", dev_id, l2cap_att_->toString().c_str());
+    }
+}
+
+bool BTAdapter::submitL2CAPSetup(BTDeviceRef device) noexcept {
+    return submitL2CAPSetupJob( L2CAPSetupJob{ device, false /* connected */, BTSecurityLevel::UNSET, false /* l2cap_open */ } );
+}
+
+bool BTAdapter::submitL2CAPConnected(BTDeviceRef device, const BTSecurityLevel sec_level, const bool l2cap_open) noexcept {
+    return submitL2CAPSetupJob( L2CAPSetupJob{ device, true /* connected */, sec_level, l2cap_open } );
+}
+
+bool BTAdapter::submitL2CAPSetupJob(L2CAPSetupJob job) noexcept {
+    const jau::nsize_t max_workers = static_cast<jau::nsize_t>( L2CAPEnv::get().L2CAP_ACCEPT_WORKERS );
+    bool start_worker = false;
+    jau::nsize_t queue_size;
+    {
+        std::unique_lock<std::mutex> lock(mtx_l2cap_setup); // RAII-style acquire and relinquish via destructor
+        if( !isValid() || l2cap_setup_closing ) {
+            return false;
+        }
+        if( !job.connected &&
+            l2cap_setup_queue.end() != std::find_if(l2cap_setup_queue.begin(), l2cap_setup_queue.end(),
+                    [&](const L2CAPSetupJob& j) -> bool { return !j.connected && j.device == job.device; }) )
+        {
+            DBG_PRINT("L2CAP-SETUP: BTAdapter::submitL2CAPSetupJob(dev_id %d): Already pending %s", dev_id, job.device->toString().c_str());
+            return true;
+        }
+        l2cap_setup_queue.push_back(job);
+        queue_size = l2cap_setup_queue.size();
+        if( l2cap_setup_workers < max_workers ) {
+            ++l2cap_setup_workers;
+            start_worker = true;
+        }
+    }
+    if( start_worker ) {
+        std::thread bg(&BTAdapter::l2capSetupWorker, this); // @suppress("Invalid arguments")
+        bg.detach();
+    }
+    DBG_PRINT("L2CAP-SETUP: BTAdapter::submitL2CAPSetupJob(dev_id %d): connected %d, pending %zu, new worker %d, %s",
+            dev_id, job.connected, (size_t)queue_size, start_worker, job.device->toString().c_str());
+    return true;
+}
+
+void BTAdapter::l2capSetupWorker() noexcept {
+    l2cap_setup_worker_adapter = this;
+    while( true ) {
+        L2CAPSetupJob job;
+        {
+            std::unique_lock<std::mutex> lock(mtx_l2cap_setup); // RAII-style acquire and relinquish via destructor
+            if( l2cap_setup_queue.empty() ) {
+                l2cap_setup_worker_adapter = nullptr;
+                --l2cap_setup_workers;
+                // notify while holding the lock, as clearL2CAPSetup() may return and this instance be destructed right after unlocking
+                cv_l2cap_setup.notify_all();
+                return;
+            }
+            job = l2cap_setup_queue.front();
+            l2cap_setup_queue.erase(l2cap_setup_queue.begin());
+        }
+        if( job.connected ) {
+            // always completes, also releasing the connect lock in case of failure
+            job.device->processL2CAPConnected(job.device, job.sec_level, job.l2cap_open);
+        } else if( job.device->getConnected() ) {
+            job.device->processL2CAPSetup(job.device);
+        } else {
+            DBG_PRINT("L2CAP-SETUP: BTAdapter::l2capSetupWorker(dev_id %d): Skipped disconnected %s", dev_id, job.device->toString().c_str());
+        }
+    }
+}
+
+void BTAdapter::clearL2CAPSetup() noexcept {
+    {
+        std::unique_lock<std::mutex> lock_setup(mtx_l2cap_setup); // RAII-style acquire and relinquish via destructor
+        std::unique_lock<std::mutex> lock_att(mtx_l2cap_att); // RAII-style acquire and relinquish via destructor
+        l2cap_setup_closing = true;
+        l2cap_setup_queue.clear();
+    }
+    cv_l2cap_att.notify_all(); // wake up workers waiting in get_l2cap_connection()
+
+    std::unique_lock<std::mutex> lock(mtx_l2cap_setup); // RAII-style acquire and relinquish via destructor
+    if( this == l2cap_setup_worker_adapter ) {
+        // Called from a user callback on one of our workers, e.g. close() within processDeviceReady():
+        // Don't wait for ourselves and only bounded for the other workers, which may run further user callbacks.
+        const jau::fraction_timespec timeout_time = jau::getMonotonicTime() + jau::fraction_timespec(THREAD_SHUTDOWN_TIMEOUT_MS);
+        while( 1 < l2cap_setup_workers ) {
+            DBG_PRINT("BTAdapter::clearL2CAPSetup(dev_id %d): On worker, waiting for %zu other workers", dev_id, (size_t)l2cap_setup_workers-1);
+            std::cv_status s = wait_until(cv_l2cap_setup, lock, timeout_time);
+            if( std::cv_status::timeout == s && 1 < l2cap_setup_workers ) {
+                WARN_PRINT("BTAdapter::clearL2CAPSetup(dev_id %d): On worker, %zu other workers still running after %s",
+                        dev_id, (size_t)l2cap_setup_workers-1, THREAD_SHUTDOWN_TIMEOUT_MS.to_string().c_str());
+                break;
+            }
+        }
+        return;
+    }
+    // Wait unconditionally, as a worker would otherwise access this instance after its destruction
+    while( 0 < l2cap_setup_workers ) {
+        DBG_PRINT("BTAdapter::clearL2CAPSetup(dev_id %d): Waiting for %zu workers", dev_id, (size_t)l2cap_setup_workers);
+        cv_l2cap_setup.wait(lock);
+    }
+}
+
 jau::fraction_i64 BTAdapter::smp_timeoutfunc(jau::simple_timer& timer) {
     if( timer.shall_stop() ) {
         return 0_s;
@@ -2143,6 +2355,7 @@ bool BTAdapter::mgmtEvDeviceDisconnectedHCI(const MgmtEvent& e) noexcept {
         device->notifyDisconnected(); // -> unpair()
         removeConnectedDevice(*device);
         gattServerData = nullptr;
+        drop_l2cap_connection(device->getAddressAndType());
 
         if( !device->isConnSecurityAutoEnabled() ) {
             int i=0;
@@ -58,6 +58,8 @@ BTDevice::BTDevice(const ctor_cookie& cc, BTAdapter & a, EInfoReport const & r)
   le_features(LE_Features::NONE),
   le_phy_tx(LE_PHYs::NONE),
   le_phy_rx(LE_PHYs::NONE),
+  le_tx_octets(0),
+  l2cap_io_profile(L2CAPIOProfile::DEFAULT),
   isConnected(false),
   allowDisconnect(false),
   supervision_timeout(0),
@@ -140,7 +142,8 @@ std::string BTDevice::toString(bool includeDiscoveredServices) const noexcept {
             "'], age[total "+std::to_string(t0-ts_creation)+", ldisc "+std::to_string(t0-ts_last_discovery)+", lup "+std::to_string(t0-ts_last_update)+
             "]ms, connected["+std::to_string(allowDisconnect)+"/"+std::to_string(isConnected)+", handle "+jau::to_hexstring(hciConnHandle)+
             ", phy[Tx "+direct_bt::to_string(le_phy_tx)+", Rx "+direct_bt::to_string(le_phy_rx)+
-            "], sec[enc "+std::to_string(pairing_data.encryption_enabled)+", lvl "+to_string(pairing_data.sec_level_conn)+", io "+to_string(pairing_data.ioCap_conn)+
+            "], le_tx_octets "+std::to_string(le_tx_octets)+
+            ", sec[enc "+std::to_string(pairing_data.encryption_enabled)+", lvl "+to_string(pairing_data.sec_level_conn)+", io "+to_string(pairing_data.ioCap_conn)+
             ", auto "+to_string(pairing_data.ioCap_auto)+", pairing "+to_string(pairing_data.mode)+", state "+to_string(pairing_data.state)+
             ", sc "+std::to_string(pairing_data.use_sc)+"]], rssi "+std::to_string(getRSSI())+
             ", tx-power "+std::to_string(tx_power)+eir_s+
@@ -171,6 +174,7 @@ void BTDevice::clearData() noexcept {
     le_features = LE_Features::NONE;
     le_phy_tx = LE_PHYs::NONE;
     le_phy_rx = LE_PHYs::NONE;
+    le_tx_octets = 0;
     // isConnected = false; // already done
     // allowDisconnect = false; // already done
     // supervision_timeout = 0; // already done
@@ -285,10 +289,19 @@ std::shared_ptr<ConnectionInfo> BTDevice::getConnectionInfo() noexcept {
                 adapter.sendDeviceUpdated("getConnectionInfo", sharedInstance, jau::getCurrentMilliseconds(), updateMask);
             }
         }
+        std::shared_ptr<BTGattHandler> gh = getGattHandler();
+        connInfo->setLinkParameter(le_phy_tx, le_phy_rx, le_tx_octets, nullptr != gh ? gh->getUsedMTU() : 0);
+        connInfo->setL2CAPStats(getL2CAPStats());
     }
     return connInfo;
 }
 
+L2CAPStats BTDevice::getL2CAPStats() const noexcept {
+    // l2cap_att gets replaced by processL2CAPSetup() in the local GATT server role
+    const std::lock_guard<std::recursive_mutex> lock_pairing(mtx_pairing); // RAII-style acquire and relinquish via destructor
+    return l2cap_att->getStats();
+}
+
 // #define TEST_NOENC 1
 
 HCIStatusCode BTDevice::connectLE(const uint16_t le_scan_interval, const uint16_t le_scan_window,
@@ -571,7 +584,12 @@ void BTDevice::notifyLEFeatures(std::shared_ptr<BTDevice> sthis, const LE_Featur
             toString().c_str());
     le_features = features;
     const bool is_local_server = BTRole::Master == btRole; // -> local GattRole::Server
-    if( addressAndType.isLEAddress() && ( !l2cap_att->is_open() || is_local_server ) ) {
+    if( addressAndType.isLEAddress() && is_local_server ) {
+        // Accepted channel's setup via the adapter's bounded worker pool, not delaying other clients
+        if( !adapter.submitL2CAPSetup(sthis) ) {
+            DBG_PRINT("BTDevice::notifyLEFeatures: L2CAP setup rejected: %s", toString().c_str());
+        }
+    } else if( addressAndType.isLEAddress() && !l2cap_att->is_open() ) {
         std::thread bg(&BTDevice::processL2CAPSetup, this, sthis); // @suppress("Invalid arguments")
         bg.detach();
     }
@@ -588,9 +606,6 @@ void BTDevice::notifyLEPhyUpdateComplete(const HCIStatusCode status, const LE_PH
 }
 
 void BTDevice::processL2CAPSetup(std::shared_ptr<BTDevice> sthis) {
-    bool callProcessDeviceReady = false;
-    bool callDisconnect = false;
-    bool smp_auto = false;
     const bool is_local_server = BTRole::Master == btRole; // -> local GattRole::Server
 
     if( addressAndType.isLEAddress() && ( is_local_server || !l2cap_att->is_open() ) ) {
@@ -622,8 +637,8 @@ void BTDevice::processL2CAPSetup(std::shared_ptr<BTDevice> sthis) {
                 to_string(io_cap_conn).c_str(),
                 to_string(sec_level).c_str());
 
-        bool l2cap_open;
         if( is_local_server ) {
+            bool l2cap_open;
             const uint64_t t0 = ( jau::environment::get().debug ) ? jau::getCurrentMilliseconds() : 0;
             std::unique_ptr<L2CAPClient> l2cap_att_new = adapter.get_l2cap_connection(sthis);
             const uint64_t td = ( jau::environment::get().debug ) ? jau::getCurrentMilliseconds() - t0 : 0;
@@ -632,6 +647,7 @@ void BTDevice::processL2CAPSetup(std::shared_ptr<BTDevice> sthis) {
                 l2cap_open = false;
             } else {
                 l2cap_att = std::move(l2cap_att_new);
+                l2cap_att->setIOProfile(l2cap_io_profile);
                 DBG_PRINT("L2CAP-ACCEPT: BTDevice::processL2CAPSetup: dev_id %d, td %" PRIu64 "ms, l2cap_att %s", adapter.dev_id, td, l2cap_att->toString().c_str());
                 if( BTSecurityLevel::UNSET < sec_level ) {
                     l2cap_open = l2cap_att->setBTSecurityLevel(sec_level);
@@ -639,40 +655,87 @@ void BTDevice::processL2CAPSetup(std::shared_ptr<BTDevice> sthis) {
                     l2cap_open = true;
                 }
             }
+            // Continue as a new job of the adapter's bounded L2CAP setup workers via processL2CAPConnected(),
+            // as it may perform lengthy processDeviceReady() incl. GATT setup and user callbacks.
+            lock_pairing.unlock();
+            submitL2CAPConnected(sthis, sec_level, l2cap_open);
         } else {
-            l2cap_open = l2cap_att->open(*this, sec_level); // initiates hciSMPMsgCallback() if sec_level > BT_SECURITY_LOW
+            // Non-blocking connect driven by the shared L2CAPConnectScheduler, not occupying this thread.
+            // Its completion continues on the adapter's bounded L2CAP setup workers via processL2CAPConnected(),
+            // as it may perform lengthy processDeviceReady().
+            struct L2CAPSetupData {
+                BTDeviceRef device;
+                BTSecurityLevel sec_level;
+            };
+            const L2CAPClient::connect_callback_t cb = jau::bindCaptureValueFunc(L2CAPSetupData{sthis, sec_level},
+                    ( void(*)(L2CAPSetupData&, bool) ) /* help template type deduction of function-ptr */
+                        ( [](L2CAPSetupData& d, bool connected) -> void {
+                            d.device->submitL2CAPConnected(d.device, d.sec_level, connected);
+                          } ) );
+            if( BTSecurityLevel::NONE >= sec_level ) {
+                // No SMP pairing and hence no adapter-wide IO capability required for this connect,
+                // release the single connecting device lock to let other devices connect concurrently.
+                adapter.unlockConnect(*this);
+            }
+            l2cap_att->setIOProfile(l2cap_io_profile);
+            if( !l2cap_att->openAsync(*this, sec_level, cb) ) { // initiates hciSMPMsgCallback() if sec_level > BT_SECURITY_LOW
+                processL2CAPSetupDone(sthis, sec_level, false /* l2cap_open */, lock_pairing);
+            } else {
+                DBG_PRINT("BTDevice::processL2CAPSetup: dev_id %u, lvl %s, connect pending, %s",
+                        adapter.dev_id, to_string(sec_level).c_str(), toString().c_str());
+            }
         }
-        const bool l2cap_enc = l2cap_open && BTSecurityLevel::NONE < sec_level;
-
-        const bool smp_enc = SMP_SUPPORTED_BY_OS ? connectSMP(sthis, sec_level) && BTSecurityLevel::NONE < sec_level : false;
+    } else {
+        DBG_PRINT("BTDevice::processL2CAPSetup: Skipped (not LE) dev_id %u, %s", adapter.dev_id, toString().c_str());
+    }
+}
 
-        DBG_PRINT("BTDevice::processL2CAPSetup: dev_id %u, lvl %s, connect[smp_enc %d, l2cap[open %d, enc %d]]",
-                adapter.dev_id, to_string(sec_level).c_str(), smp_enc, l2cap_open, l2cap_enc);
+void BTDevice::processL2CAPConnected(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open) {
+    std::unique_lock<std::recursive_mutex> lock_pairing(mtx_pairing); // RAII-style acquire and relinquish via destructor
+    processL2CAPSetupDone(sthis, sec_level, l2cap_open, lock_pairing);
+}
 
+void BTDevice::submitL2CAPConnected(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open) noexcept {
+    if( !adapter.submitL2CAPConnected(sthis, sec_level, l2cap_open) ) {
+        DBG_PRINT("BTDevice::submitL2CAPConnected: Rejected, adapter closing: %s", toString().c_str());
         adapter.unlockConnect(*this);
+    }
+}
 
-        if( !l2cap_open ) {
-            pairing_data.sec_level_conn = BTSecurityLevel::NONE;
-            const SMPIOCapability smp_auto_io_cap = pairing_data.ioCap_auto; // cache against clearSMPState
-            smp_auto = SMPIOCapability::UNSET != smp_auto_io_cap; // logical cached state
-            if( smp_auto ) {
-                pairing_data.mode = PairingMode::NONE;
-                pairing_data.state = SMPPairingState::FAILED;
-                lock_pairing.unlock(); // unlock mutex before notify_all to avoid pessimistic re-block of notified wait() thread.
-                cv_pairing_state_changed.notify_all();
-            } else {
-                callDisconnect = true;
-                disconnect(HCIStatusCode::INTERNAL_FAILURE);
-            }
-        } else if( !l2cap_enc ) {
-            callProcessDeviceReady = true;
-            lock_pairing.unlock(); // unlock mutex before notifying and `processDeviceReady()`
-            const uint64_t ts = jau::getCurrentMilliseconds();
-            adapter.notifyPairingStageDone(sthis, ts);
-            processDeviceReady(sthis, ts);
+void BTDevice::processL2CAPSetupDone(std::shared_ptr<BTDevice> sthis, const BTSecurityLevel sec_level, const bool l2cap_open,
+                                     std::unique_lock<std::recursive_mutex>& lock_pairing) {
+    bool callProcessDeviceReady = false;
+    bool callDisconnect = false;
+    bool smp_auto = false;
+
+    const bool l2cap_enc = l2cap_open && BTSecurityLevel::NONE < sec_level;
+
+    const bool smp_enc = SMP_SUPPORTED_BY_OS ? connectSMP(sthis, sec_level) && BTSecurityLevel::NONE < sec_level : false;
+
+    DBG_PRINT("BTDevice::processL2CAPSetup: dev_id %u, lvl %s, connect[smp_enc %d, l2cap[open %d, enc %d]]",
+            adapter.dev_id, to_string(sec_level).c_str(), smp_enc, l2cap_open, l2cap_enc);
+
+    adapter.unlockConnect(*this);
+
+    if( !l2cap_open ) {
+        pairing_data.sec_level_conn = BTSecurityLevel::NONE;
+        const SMPIOCapability smp_auto_io_cap = pairing_data.ioCap_auto; // cache against clearSMPState
+        smp_auto = SMPIOCapability::UNSET != smp_auto_io_cap; // logical cached state
+        if( smp_auto ) {
+            pairing_data.mode = PairingMode::NONE;
+            pairing_data.state = SMPPairingState::FAILED;
+            lock_pairing.unlock(); // unlock mutex before notify_all to avoid pessimistic re-block of notified wait() thread.
+            cv_pairing_state_changed.notify_all();
+        } else {
+            callDisconnect = true;
+            disconnect(HCIStatusCode::INTERNAL_FAILURE);
         }
-    } else {
-        DBG_PRINT("BTDevice::processL2CAPSetup: Skipped (not LE) dev_id %u, %s", adapter.dev_id, toString().c_str());
+    } else if( !l2cap_enc ) {
+        callProcessDeviceReady = true;
+        lock_pairing.unlock(); // unlock mutex before notifying and `processDeviceReady()`
+        const uint64_t ts = jau::getCurrentMilliseconds();
+        adapter.notifyPairingStageDone(sthis, ts);
+        processDeviceReady(sthis, ts);
     }
     DBG_PRINT("BTDevice::processL2CAPSetup: End [dev_id %u, disconnect %d, deviceReady %d, smp_auto %d], %s",
             adapter.dev_id, callDisconnect, callProcessDeviceReady, smp_auto, toString().c_str());
@@ -706,6 +769,8 @@ void BTDevice::processDeviceReady(std::shared_ptr<BTDevice> sthis, const uint64_
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
     }
+    processLEThroughputProfile();
+
     const bool gatt_res = connectGATT(sthis);
 
     if( !gatt_res && using_enc ) {
@@ -1723,6 +1788,14 @@ bool BTDevice::isConnSecurityAutoEnabled() const noexcept {
     return SMPIOCapability::UNSET != pairing_data.ioCap_auto;
 }
 
+bool BTDevice::setConnIOProfile(const L2CAPIOProfile io_profile) noexcept {
+    const std::unique_lock<std::recursive_mutex> lock_pairing(mtx_pairing); // RAII-style acquire and relinquish via destructor, guarding l2cap_att replacement
+    l2cap_io_profile = io_profile;
+    const bool res = l2cap_att->setIOProfile(io_profile);
+    DBG_PRINT("BTDevice::setConnIOProfile: %s, res %d, %s", to_string(io_profile).c_str(), res, toString().c_str());
+    return res;
+}
+
 HCIStatusCode BTDevice::setPairingPasskey(const uint32_t passkey) noexcept {
     const std::unique_lock<std::recursive_mutex> lock_pairing(mtx_pairing); // RAII-style acquire and relinquish via destructor
 
@@ -2039,6 +2112,39 @@ BTGattCharRef BTDevice::findGattChar(const jau::uuid_t& char_uuid) noexcept {
     return nullptr;
 }
 
+std::unique_ptr<L2CAPClient> BTDevice::openL2CAPChannel(const L2CAP_PSM psm, const uint16_t rx_mtu, const BTSecurityLevel sec_level,
+                                                       const L2CAPIOProfile io_profile) noexcept {
+    if( !isValidInstance() ) {
+        ERR_PRINT("Device invalid: %p", jau::to_hexstring((void*)this).c_str());
+        return nullptr;
+    }
+    if( !isConnected ) {
+        WARN_PRINT("Not connected: psm %s, %s", to_string(psm).c_str(), toString().c_str());
+        return nullptr;
+    }
+    if( !addressAndType.isLEAddress() ) {
+        ERR_PRINT("Not an LE device: psm %s, %s", to_string(psm).c_str(), toString().c_str());
+        return nullptr;
+    }
+    if( !is_LE_SPSM(psm) ) {
+        ERR_PRINT("Invalid LE SPSM: psm %s, %s", to_string(psm).c_str(), toString().c_str());
+        return nullptr;
+    }
+    if( 0 < rx_mtu && L2CAPComm::LE_COC_MIN_MTU > rx_mtu ) {
+        ERR_PRINT("Invalid rx_mtu %u < %u: psm %s, %s", rx_mtu, L2CAPComm::LE_COC_MIN_MTU, to_string(psm).c_str(), toString().c_str());
+        return nullptr;
+    }
+    std::unique_ptr<L2CAPClient> l2cap = std::make_unique<L2CAPClient>(adapter.dev_id, adapter.getAddressAndType(), psm, L2CAP_CID::UNDEFINED, rx_mtu);
+    l2cap->setIOProfile(io_profile);
+    if( !l2cap->open(*this, sec_level) ) {
+        ERR_PRINT("Open failed: psm %s, rx_mtu %u, %s", to_string(psm).c_str(), rx_mtu, toString().c_str());
+        return nullptr;
+    }
+    DBG_PRINT("BTDevice::openL2CAPChannel: psm %s, mtu[rx %u, tx %u], %s",
+              to_string(psm).c_str(), l2cap->getRxMTU(), l2cap->getTxMTU(), l2cap->toString().c_str());
+    return l2cap;
+}
+
 bool BTDevice::sendNotification(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept {
     if( !isValidInstance() ) {
         ERR_PRINT("Device invalid: %p", jau::to_hexstring((void*)this).c_str());
@@ -2177,10 +2283,51 @@ HCIStatusCode BTDevice::setConnectedLE_PHY(const LE_PHYs Tx, const LE_PHYs Rx) n
     return hci.le_set_phy(hciConnHandle, addressAndType, Tx, Rx);
 }
 
+HCIStatusCode BTDevice::setConnectedLE_DataLength(const uint16_t tx_octets, const uint16_t tx_time) noexcept {
+    const std::lock_guard<std::recursive_mutex> lock_conn(mtx_connect); // RAII-style acquire and relinquish via destructor
+
+    if( !isConnected ) { // should not happen
+        return HCIStatusCode::DISCONNECTED;
+    }
+
+    if( 0 == hciConnHandle ) {
+        return HCIStatusCode::UNSPECIFIED_ERROR;
+    }
+
+    if( !adapter.isPowered() ) { // isValid() && hci.isOpen() && POWERED
+        return HCIStatusCode::NOT_POWERED; // powered-off
+    }
+
+    HCIHandler &hci = adapter.getHCI();
+    HCIStatusCode res = hci.le_set_data_length(hciConnHandle, addressAndType, tx_octets, tx_time);
+    if( HCIStatusCode::SUCCESS == res ) {
+        le_tx_octets = tx_octets;
+    }
+    return res;
+}
+
+void BTDevice::processLEThroughputProfile() noexcept {
+    if( !adapter.getHCI().env.HCI_LE_THROUGHPUT_AUTO || !addressAndType.isLEAddress() ) {
+        return;
+    }
+    HCIStatusCode res_dl = HCIStatusCode::UNSUPPORTED_FEATURE_OR_PARAM_VALUE;
+    HCIStatusCode res_phy = HCIStatusCode::UNSUPPORTED_FEATURE_OR_PARAM_VALUE;
+    if( is_set(le_features, LE_Features::LE_Data_Pkt_Len_Ext) ) {
+        // 251 octets payload, 2120us max transmission time on LE_1M
+        res_dl = setConnectedLE_DataLength(251, 2120);
+    }
+    if( is_set(le_features, LE_Features::LE_2M_PHY) ) {
+        res_phy = setConnectedLE_PHY(LE_PHYs::LE_2M, LE_PHYs::LE_2M);
+    }
+    DBG_PRINT("BTDevice::processLEThroughputProfile: data length %s, phy %s, %s",
+            to_string(res_dl).c_str(), to_string(res_phy).c_str(), toString().c_str());
+}
+
 void BTDevice::notifyDisconnected() noexcept {
     // coming from disconnect callback, ensure cleaning up!
     DBG_PRINT("BTDevice::notifyDisconnected: handle %s -> zero, %s",
               jau::to_hexstring(hciConnHandle).c_str(), toString().c_str());
+    const bool wasConnected = isConnected;
     allowDisconnect = false;
     supervision_timeout = 0;
     isConnected = false;
@@ -2190,6 +2337,9 @@ void BTDevice::notifyDisconnected() noexcept {
     disconnectGATT(1);
     disconnectSMP(1);
     l2cap_att->close();
+    if( wasConnected ) {
+        adapter.addClosedL2CAPStats( l2cap_att->getStats() ); // once per connection
+    }
     // clearData(); to be performed after notifying listener and if !isConnSecurityAutoEnabled()
 }
 
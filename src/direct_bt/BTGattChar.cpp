@@ -100,7 +100,22 @@ std::string direct_bt::to_string(const BTGattChar::PropertyBitVal mask) noexcept
     return out;
 }
 
+bool BTGattChar::ensureDescriptorsDiscovered() noexcept {
+    if( descriptorsDiscovered ) {
+        return true;
+    }
+    std::shared_ptr<BTGattHandler> gatt = getGattHandlerUnchecked();
+    if( nullptr == gatt ) {
+        ERR_PRINT("Characteristic's device GATTHandle not connected: %s", toShortString().c_str());
+        return false;
+    }
+    return gatt->discoverDescriptors(*this);
+}
+
 std::shared_ptr<BTGattDesc> BTGattChar::findGattDesc(const jau::uuid_t& desc_uuid) noexcept {
+    if( !ensureDescriptorsDiscovered() ) {
+        return nullptr;
+    }
     const size_t descriptors_size = descriptorList.size();
     for(size_t j = 0; j < descriptors_size; j++) {
         direct_bt::BTGattDescRef descriptor = descriptorList[j];
@@ -120,7 +135,7 @@ std::string BTGattChar::toString() const noexcept {
         char_name = ", "+GattCharacteristicTypeToString(static_cast<GattCharacteristicType>(uuid16));
     }
     {
-        BTGattDescRef ud = getUserDescription();
+        BTGattDescRef ud = getUserDescriptionUnchecked();
         if( nullptr != ud ) {
             char_name.append( ", '" + dfa_utf8_decode( ud->value.get_ptr(), ud->value.size() ) + "'");
         }
@@ -149,6 +164,12 @@ std::string BTGattChar::toString() const noexcept {
            "]]";
 }
 
+std::string BTGattChar::StreamWriteStats::toString() const noexcept {
+    return "StreamWrite[bytes "+std::to_string(bytes)+", pdus "+std::to_string(pdu_count)+
+           ", stalls "+std::to_string(stall_count)+", "+std::to_string(duration_ms)+
+           " ms, "+std::to_string(static_cast<uint64_t>( getThroughput() ))+" bytes/s]";
+}
+
 std::string BTGattChar::toShortString() const noexcept {
     std::string char_name;
 
@@ -157,7 +178,7 @@ std::string BTGattChar::toShortString() const noexcept {
         char_name = ", "+GattCharacteristicTypeToString(static_cast<GattCharacteristicType>(uuid16));
     }
     {
-        BTGattDescRef ud = getUserDescription();
+        BTGattDescRef ud = getUserDescriptionUnchecked();
         if( nullptr != ud ) {
             char_name.append( ", '" + dfa_utf8_decode( ud->value.get_ptr(), ud->value.size() ) + "'");
         }
@@ -350,3 +371,20 @@ bool BTGattChar::writeValueNoResp(const TROOctets & value) noexcept {
     }
     return gatt->writeCharacteristicValueNoResp(*this, value);
 }
+
+/**
+ * BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.1 Write Characteristic Value Without Response
+ */
+bool BTGattChar::writeValueNoRespStream(const TROOctets & value, StreamWriteStats * stats) noexcept {
+    std::shared_ptr<BTDevice> device = getDeviceUnchecked();
+    if( nullptr == device ) {
+        ERR_PRINT("Characteristic's device null: %s", toShortString().c_str());
+        return false;
+    }
+    std::shared_ptr<BTGattHandler> gatt = device->getGattHandler();
+    if( nullptr == gatt ) {
+        ERR_PRINT("Characteristic's device GATTHandle not connected: %s", toShortString().c_str());
+        return false;
+    }
+    return gatt->writeCharacteristicValueNoRespStream(*this, value, stats);
+}
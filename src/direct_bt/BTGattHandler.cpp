@@ -28,6 +28,7 @@
 #include <memory>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include  <algorithm>
 
@@ -71,6 +72,9 @@ BTGattEnv::BTGattEnv() noexcept
   GATT_WRITE_COMMAND_REPLY_TIMEOUT(  jau::environment::getFractionProperty("direct_bt.gatt.cmd.write.timeout", 550_ms, 550_ms /* min */, 365_d /* max */) ),
   GATT_INITIAL_COMMAND_REPLY_TIMEOUT( jau::environment::getFractionProperty("direct_bt.gatt.cmd.init.timeout", 2500_ms, 2000_ms /* min */, 365_d /* max */) ),
   ATTPDU_RING_CAPACITY( jau::environment::getInt32Property("direct_bt.gatt.ringsize", 128, 64 /* min */, 1024 /* max */) ),
+  GATT_LAZY_DESCRIPTOR_DISCOVERY( jau::environment::getBooleanProperty("direct_bt.gatt.discovery.lazy", false) ),
+  GATT_INDICATION_QUEUE_CAPACITY( jau::environment::getInt32Property("direct_bt.gatt.indication.queue", 32, 1 /* min */, 1024 /* max */) ),
+  GATT_FWD_WRITE_CMD_QUEUE_CAPACITY( jau::environment::getInt32Property("direct_bt.gatt.fwd.writecmd.queue", 64, 1 /* min */, 1024 /* max */) ),
   DEBUG_DATA( jau::environment::getBooleanProperty("direct_bt.debug.gatt.data", false) )
 {
 }
@@ -377,6 +381,12 @@ bool BTGattHandler::replyAttPDUReq(std::unique_ptr<const AttPDUMsg> && pdu) noex
             return gattServerHandler->replyReadReq( pdu.get() );
         }
 
+        case AttPDUMsg::Opcode::READ_MULTIPLE_REQ: // 14
+            [[fallthrough]];
+        case AttPDUMsg::Opcode::READ_MULTIPLE_VARIABLE_REQ: { // 32
+            return gattServerHandler->replyReadMultipleReq( static_cast<const AttReadMultipleReq*>( pdu.get() ) );
+        }
+
         case AttPDUMsg::Opcode::READ_BY_GROUP_TYPE_REQ: { // 16
             return gattServerHandler->replyReadByGroupTypeReq( static_cast<const AttReadByNTypeReq*>( pdu.get() ) );
         }
@@ -393,10 +403,6 @@ bool BTGattHandler::replyAttPDUReq(std::unique_ptr<const AttPDUMsg> && pdu) noex
 
         // TODO: Add support for the following requests
 
-        case AttPDUMsg::Opcode::READ_MULTIPLE_REQ: // 14
-            [[fallthrough]];
-        case AttPDUMsg::Opcode::READ_MULTIPLE_VARIABLE_REQ: // 32
-            [[fallthrough]];
         case AttPDUMsg::Opcode::SIGNED_WRITE_CMD: { // 18 + 64 + 128 = 210
             AttErrorRsp rsp(AttErrorRsp::ErrorCode::UNSUPPORTED_REQUEST, pdu->getOpcode(), 0);
             WARN_PRINT("GATT Req: Ignored: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), toString().c_str());
@@ -418,6 +424,44 @@ bool BTGattHandler::replyAttPDUReq(std::unique_ptr<const AttPDUMsg> && pdu) noex
     }
 }
 
+void BTGattHandler::dispatchNotification(const uint16_t handle, const jau::TROOctets& value, const uint64_t timestamp) noexcept {
+    BTDeviceRef device = getDeviceUnchecked();
+    if( nullptr != device ) {
+        int i=0;
+        jau::for_each_fidelity(nativeGattCharListenerList, [&](std::shared_ptr<NativeGattCharListener> &l) {
+            try {
+                l->notificationReceived(device, handle, value, timestamp);
+            } catch (std::exception &e) {
+                ERR_PRINT("GATTHandler::notificationReceived-CBs %d/%zd: NativeGattCharListener %s: Caught exception %s",
+                        i+1, nativeGattCharListenerList.size(),
+                        jau::to_hexstring((void*)l.get()).c_str(), e.what());
+            }
+            i++;
+        });
+    }
+    BTGattCharRef characteristic = findCharacterisicsByValueHandle(services, handle);
+    if( nullptr != characteristic ) {
+        int i=0;
+        jau::for_each_fidelity(gattCharListenerList, [&](GattCharListenerPair &p) {
+            try {
+                if( p.match(*characteristic) ) {
+                    p.listener->notificationReceived(characteristic, value, timestamp);
+                }
+            } catch (std::exception &e) {
+                ERR_PRINT("GATTHandler::notificationReceived-CBs %d/%zd: BTGattCharListener %s: Caught exception %s",
+                        i+1, gattCharListenerList.size(),
+                        jau::to_hexstring((void*)p.listener.get()).c_str(), e.what());
+            }
+            i++;
+        });
+    }
+}
+
+void BTGattHandler::l2capReaderInit(jau::service_runner& sr) noexcept {
+    (void)sr;
+    l2cap_reader_id = std::this_thread::get_id();
+}
+
 void BTGattHandler::l2capReaderWork(jau::service_runner& sr) noexcept {
     jau::snsize_t len;
     if( !validateConnected() ) {
@@ -426,63 +470,27 @@ void BTGattHandler::l2capReaderWork(jau::service_runner& sr) noexcept {
         return;
     }
 
-    len = l2cap.read(rbuffer.get_wptr(), rbuffer.size());
-    if( 0 < len ) {
-        std::unique_ptr<const AttPDUMsg> attPDU = AttPDUMsg::getSpecialized(rbuffer.get_ptr(), static_cast<jau::nsize_t>(len));
-        COND_PRINT(env.DEBUG_DATA, "GATTHandler::reader: Got %s", attPDU->toString().c_str());
-
-        const AttPDUMsg::Opcode opc = attPDU->getOpcode();
-        const AttPDUMsg::OpcodeType opc_type = AttPDUMsg::get_type(opc);
-
-        if( AttPDUMsg::Opcode::MULTIPLE_HANDLE_VALUE_NTF == opc ) { // AttPDUMsg::OpcodeType::NOTIFICATION
-            // FIXME TODO ..
-            ERR_PRINT("MULTI-NTF not implemented: %s", attPDU->toString().c_str());
-        } else if( AttPDUMsg::Opcode::HANDLE_VALUE_NTF == opc ) { // AttPDUMsg::OpcodeType::NOTIFICATION
-            const AttHandleValueRcv * a = static_cast<const AttHandleValueRcv*>(attPDU.get());
+    // wait at most until the pending indication's confirmation times out, otherwise use L2CAPEnv::L2CAP_READER_POLL_TIMEOUT
+    const int32_t ind_timeoutMS = GATTRole::Server == role ? checkIndicationTimeout() : 0;
+    if( 0 < ind_timeoutMS ) {
+        len = l2cap.read(rbuffer.get_wptr(), rbuffer.size(), ind_timeoutMS);
+    } else {
+        len = l2cap.read(rbuffer.get_wptr(), rbuffer.size());
+    }
+    if( 0 < len && AttHandleValueRcvView::isValid(rbuffer.get_ptr(), static_cast<jau::nsize_t>(len)) ) {
+        // Notifications and indications are dispatched straight from rbuffer, w/o copy and allocation
+        const AttHandleValueRcvView a(rbuffer.get_ptr(), static_cast<jau::nsize_t>(len));
+        if( a.isNotification() ) { // AttPDUMsg::OpcodeType::NOTIFICATION
             COND_PRINT(env.DEBUG_DATA, "GATTHandler::reader: NTF: %s, listener [native %zd, bt %zd]",
-                    a->toString().c_str(), nativeGattCharListenerList.size(), gattCharListenerList.size());
-            const uint64_t a_timestamp = a->ts_creation;
-            const uint16_t a_handle = a->getHandle();
-            const jau::TOctetSlice& a_value = a->getValue();
-            const jau::TROOctets a_data_view(a_value.get_ptr_nc(0), a_value.size(), a_value.byte_order()); // just a view, still owned by attPDU
-            BTDeviceRef device = getDeviceUnchecked();
-            if( nullptr != device ) {
-                int i=0;
-                jau::for_each_fidelity(nativeGattCharListenerList, [&](std::shared_ptr<NativeGattCharListener> &l) {
-                    try {
-                        l->notificationReceived(device, a_handle, a_data_view, a_timestamp);
-                    } catch (std::exception &e) {
-                        ERR_PRINT("GATTHandler::notificationReceived-CBs %d/%zd: NativeGattCharListener %s: Caught exception %s",
-                                i+1, nativeGattCharListenerList.size(),
-                                jau::to_hexstring((void*)l.get()).c_str(), e.what());
-                    }
-                    i++;
-                });
-            }
-            BTGattCharRef characteristic = findCharacterisicsByValueHandle(services, a_handle);
-            if( nullptr != characteristic ) {
-                int i=0;
-                jau::for_each_fidelity(gattCharListenerList, [&](GattCharListenerPair &p) {
-                    try {
-                        if( p.match(*characteristic) ) {
-                            p.listener->notificationReceived(characteristic, a_data_view, a_timestamp);
-                        }
-                    } catch (std::exception &e) {
-                        ERR_PRINT("GATTHandler::notificationReceived-CBs %d/%zd: BTGattCharListener %s: Caught exception %s",
-                                i+1, gattCharListenerList.size(),
-                                jau::to_hexstring((void*)p.listener.get()).c_str(), e.what());
-                    }
-                    i++;
-                });
-            }
-        } else if( AttPDUMsg::Opcode::HANDLE_VALUE_IND == opc ) { // AttPDUMsg::OpcodeType::INDICATION
-            const AttHandleValueRcv * a = static_cast<const AttHandleValueRcv*>(attPDU.get());
+                    a.toString().c_str(), nativeGattCharListenerList.size(), gattCharListenerList.size());
+            dispatchNotification(a.getHandle(), a.getValue() /* just a view, still owned by rbuffer */, a.ts_creation);
+        } else { // AttPDUMsg::OpcodeType::INDICATION
             COND_PRINT(env.DEBUG_DATA, "GATTHandler::reader: IND: %s, sendIndicationConfirmation %d, listener [native %zd, bt %zd]",
-                    a->toString().c_str(), sendIndicationConfirmation.load(), nativeGattCharListenerList.size(), gattCharListenerList.size());
+                    a.toString().c_str(), sendIndicationConfirmation.load(), nativeGattCharListenerList.size(), gattCharListenerList.size());
             bool cfmSent = false;
             if( sendIndicationConfirmation ) {
                 AttHandleValueCfm cfm;
-                if( !send(cfm) ) {
+                if( !sendQueued(cfm) ) {
                     ERR_PRINT2("Indication Confirmation: Error req %s; %s", cfm.toString().c_str(), toString().c_str());
                     sr.set_shall_stop();
                     has_ioerror = true;
@@ -490,10 +498,9 @@ void BTGattHandler::l2capReaderWork(jau::service_runner& sr) noexcept {
                 }
                 cfmSent = true;
             }
-            const uint64_t a_timestamp = a->ts_creation;
-            const uint16_t a_handle = a->getHandle();
-            const jau::TOctetSlice& a_value = a->getValue();
-            const jau::TROOctets a_data_view(a_value.get_ptr_nc(0), a_value.size(), a_value.byte_order()); // just a view, still owned by attPDU
+            const uint64_t a_timestamp = a.ts_creation;
+            const uint16_t a_handle = a.getHandle();
+            const jau::TROOctets& a_data_view = a.getValue(); // just a view, still owned by rbuffer
             BTDeviceRef device = getDeviceUnchecked();
             if( nullptr != device ) {
                 int i=0;
@@ -524,6 +531,28 @@ void BTGattHandler::l2capReaderWork(jau::service_runner& sr) noexcept {
                     i++;
                 });
             }
+        }
+    } else if( 0 < len ) {
+        std::unique_ptr<const AttPDUMsg> attPDU = AttPDUMsg::getSpecialized(rbuffer.get_ptr(), static_cast<jau::nsize_t>(len));
+        COND_PRINT(env.DEBUG_DATA, "GATTHandler::reader: Got %s", attPDU->toString().c_str());
+
+        const AttPDUMsg::Opcode opc = attPDU->getOpcode();
+        const AttPDUMsg::OpcodeType opc_type = AttPDUMsg::get_type(opc);
+
+        if( AttPDUMsg::Opcode::MULTIPLE_HANDLE_VALUE_NTF == opc ) { // AttPDUMsg::OpcodeType::NOTIFICATION
+            // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.4 ATT_MULTIPLE_HANDLE_VALUE_NTF, dispatched per handle value tuple
+            const AttMultipleHandleValueNtf * ntf = static_cast<const AttMultipleHandleValueNtf*>(attPDU.get());
+            uint16_t handle;
+            jau::nsize_t value_size;
+            for(jau::nsize_t offset = 1, next; 0 != ( next = ntf->getTuple(offset, handle, value_size) ); offset = next) {
+                const jau::TROOctets value(ntf->pdu.get_ptr() + offset + 4, value_size, jau::endian::little); // view owned by ntf
+                dispatchNotification(handle, value, ntf->ts_creation);
+            }
+        } else if( AttPDUMsg::Opcode::HANDLE_VALUE_CFM == opc && GATTRole::Server == role ) {
+            // Pipelined indications, see sendIndicationAsync()
+            if( !completeIndication(true) ) {
+                WARN_PRINT("GATTHandler::reader: Unexpected %s; %s", attPDU->toString().c_str(), toString().c_str());
+            }
         } else if( AttPDUMsg::OpcodeType::RESPONSE == opc_type ) {
             COND_PRINT(env.DEBUG_DATA, "GATTHandler::reader: Ring: %s", attPDU->toString().c_str());
             attPDURing.putBlocking( std::move(attPDU), 0_s );
@@ -600,7 +629,7 @@ BTGattHandler::BTGattHandler(const BTDeviceRef &device, L2CAPClient& l2cap_att,
   is_connected(l2cap.is_open()), has_ioerror(false),
   l2cap_reader_service("GATTHandler::reader_"+deviceString, THREAD_SHUTDOWN_TIMEOUT_MS,
                        jau::bindMemberFunc(this, &BTGattHandler::l2capReaderWork),
-                       jau::service_runner::Callback() /* init */,
+                       jau::bindMemberFunc(this, &BTGattHandler::l2capReaderInit),
                        jau::bindMemberFunc(this, &BTGattHandler::l2capReaderEndLocked)),
   attPDURing(env.ATTPDU_RING_CAPACITY),
   serverMTU(number(Defaults::MIN_ATT_MTU)), usedMTU(number(Defaults::MIN_ATT_MTU)), clientMTUExchanged(false),
@@ -638,6 +667,7 @@ BTGattHandler::BTGattHandler(const BTDeviceRef &device, L2CAPClient& l2cap_att,
         usedMTU = number(Defaults::MIN_ATT_MTU);
 
         if( nullptr != gattServerData ) {
+            gattServerData->addConnectedDevice(device);
             int i=0;
             jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
                 try {
@@ -691,11 +721,16 @@ bool BTGattHandler::disconnect(const bool disconnect_device, const bool ioerr_ca
     }
 
     PERF3_TS_TD("GATTHandler::disconnect.1");
+    l2cap.wakeup(); // interrupt blocking read(), l2capReaderInterrupted() holds w/o is_connected
     const bool l2cap_service_stop_res = l2cap_reader_service.stop();
     l2cap.close(); // owned by BTDevice.
     PERF3_TS_TD("GATTHandler::disconnect.X");
 
     gattServerHandler->close();
+    flushIndications();
+    if( nullptr != gattServerData ) {
+        gattServerData->removeConnectedDevice(device);
+    }
 
     // Lock to avoid other threads using instance while disconnecting
     const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
@@ -734,24 +769,70 @@ bool BTGattHandler::send(const AttPDUMsg & msg) noexcept {
         return false;
     }
 
-    // Thread safe l2cap.write(..) operation..
-    const jau::snsize_t len = l2cap.write(msg.pdu.get_ptr(), msg.pdu.size());
+    return l2capWrite(msg.pdu.get_ptr(), msg.pdu.size(), nullptr, 0, &msg);
+}
+
+bool BTGattHandler::sendQueued(const AttPDUMsg & msg) noexcept {
+    if( !validateConnected() ) {
+        if( !l2capReaderInterrupted() ) {
+            ERR_PRINT("Invalid IO State: req %s to %s", msg.toString().c_str(), toString().c_str());
+        }
+        return false;
+    }
+    // [1 .. ATT_MTU-1] BT Core Spec v5.2: Vol 3, Part F 3.2.9 Long attribute values
+    if( msg.pdu.size() > usedMTU ) {
+        ERR_PRINT("Msg PDU size %zu >= used MTU %u, req %s to %s",
+                msg.pdu.size(), usedMTU.load(), msg.toString().c_str(), toString().c_str());
+        return false;
+    }
+    return l2capWrite(msg.pdu.get_ptr(), msg.pdu.size(), nullptr, 0, &msg, true /* queued */);
+}
+
+bool BTGattHandler::sendScattered(const uint8_t* header, const jau::nsize_t header_size,
+                                  const uint8_t* value, const jau::nsize_t value_size, const bool queued) noexcept {
+    if( !validateConnected() ) {
+        if( !l2capReaderInterrupted() ) {
+            ERR_PRINT("Invalid IO State: opcode %s to %s", 0 < header_size ? jau::to_hexstring(header[0]).c_str() : "n/a", toString().c_str());
+        }
+        return false;
+    }
+    // [1 .. ATT_MTU-1] BT Core Spec v5.2: Vol 3, Part F 3.2.9 Long attribute values
+    if( 0 == header_size || header_size + value_size > usedMTU ) {
+        ERR_PRINT("PDU size %zu + %zu > used MTU %u, opcode %s to %s",
+                header_size, value_size, usedMTU.load(),
+                0 < header_size ? jau::to_hexstring(header[0]).c_str() : "n/a", toString().c_str());
+        return false;
+    }
+    return l2capWrite(header, header_size, value, value_size, nullptr, queued);
+}
+
+bool BTGattHandler::l2capWrite(const uint8_t* header, const jau::nsize_t header_size,
+                               const uint8_t* payload, const jau::nsize_t payload_size, const AttPDUMsg* msg,
+                               const bool queued) noexcept {
+    const jau::nsize_t size = header_size + payload_size;
+    // Thread safe l2cap.writev(..) or l2cap.writeQueued(..) operation..
+    const jau::snsize_t len = queued ? l2cap.writeQueued(header, header_size, payload, payload_size)
+                                     : l2cap.writev(header, header_size, payload, payload_size);
     if( 0 > len ) {
-        if( len == L2CAPClient::number(L2CAPClient::RWExitCode::INTERRUPTED) ) { // expected exits
+        if( len == L2CAPClient::number(L2CAPClient::RWExitCode::QUEUE_FULL) ) { // backpressure
+            WARN_PRINT("l2cap write: Queue full, %zu packets; %s; %s",
+                    (size_t)l2cap.getSendQueueSize(),
+                    nullptr != msg ? msg->toString().c_str() : jau::to_hexstring(header[0]).c_str(), toString().c_str());
+        } else if( len == L2CAPClient::number(L2CAPClient::RWExitCode::INTERRUPTED) ) { // expected exits
             WORDY_PRINT("GATTHandler::reader: l2cap read: IRQed res %d (%s); %s",
                     len, L2CAPClient::getRWExitCodeString(len).c_str(), getStateString().c_str());
         } else {
             ERR_PRINT("l2cap write: Error res %d (%s); %s; %s -> disconnect: %s",
                     len, L2CAPClient::getRWExitCodeString(len).c_str(), getStateString().c_str(),
-                    msg.toString().c_str(), toString().c_str());
+                    nullptr != msg ? msg->toString().c_str() : jau::to_hexstring(header[0]).c_str(), toString().c_str());
             has_ioerror = true;
             disconnect(true /* disconnect_device */, true /* ioerr_cause */); // state -> Disconnected
         }
         return false;
     }
-    if( static_cast<size_t>(len) != msg.pdu.size() ) {
+    if( static_cast<size_t>(len) != size ) {
         ERR_PRINT("l2cap write: Error: Message size has %d != exp %zu: %s -> disconnect: %s",
-                len, msg.pdu.size(), msg.toString().c_str(), toString().c_str());
+                len, size, nullptr != msg ? msg->toString().c_str() : jau::to_hexstring(header[0]).c_str(), toString().c_str());
         has_ioerror = true;
         disconnect(true /* disconnect_device */, true /* ioerr_cause */); // state -> Disconnected
         return false;
@@ -829,6 +910,14 @@ DBGattCharRef BTGattHandler::findServerGattCharByValueHandle(const uint16_t char
 }
 
 bool BTGattHandler::sendNotification(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept {
+    return sendNotificationImpl(char_value_handle, value, false /* queued */);
+}
+
+bool BTGattHandler::sendNotificationAsync(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept {
+    return sendNotificationImpl(char_value_handle, value, true /* queued */);
+}
+
+bool BTGattHandler::sendNotificationImpl(const uint16_t char_value_handle, const jau::TROOctets & value, const bool queued) noexcept {
     if( GATTRole::Server != role ) {
         ERR_PRINT("GATTRole not server");
         return false;
@@ -843,13 +932,90 @@ bool BTGattHandler::sendNotification(const uint16_t char_value_handle, const jau
         COND_PRINT(env.DEBUG_DATA, "GATT SEND NTF: Zero size, skipped sending to %s", toString().c_str());
         return true;
     }
+    // queued: L2CAPClient::writeQueued() is thread safe, don't block on mtx_command
+    std::unique_lock<std::recursive_mutex> lock(mtx_command, std::defer_lock); // RAII-style acquire and relinquish via destructor
+    if( !queued ) {
+        lock.lock();
+    }
+    // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.1 ATT_HANDLE_VALUE_NTF, value truncated to ATT_MTU-3
+    uint8_t header[3];
+    header[0] = AttPDUMsg::number(AttPDUMsg::Opcode::HANDLE_VALUE_NTF);
+    jau::put_uint16(header, 1, char_value_handle, true /* littleEndian */);
+    const jau::nsize_t value_size = std::min<jau::nsize_t>(usedMTU - 3, value.size());
+    COND_PRINT(env.DEBUG_DATA, "GATT SEND NTF: handle %s, value size %zu/%zu, queued %d to %s",
+            jau::to_hexstring(char_value_handle).c_str(), value_size, value.size(), queued, toString().c_str());
+    return sendScattered(header, sizeof(header), value.get_ptr(), value_size, queued);
+}
+
+bool BTGattHandler::sendMultipleNotification(const AttMultipleHandleValueNtf & ntf) noexcept {
+    if( GATTRole::Server != role ) {
+        ERR_PRINT("GATTRole not server");
+        return false;
+    }
     const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
-    AttHandleValueRcv data(true /* isNotify */, char_value_handle, value, usedMTU);
-    COND_PRINT(env.DEBUG_DATA, "GATT SEND NTF: %s to %s", data.toString().c_str(), toString().c_str());
-    return send(data);
+    COND_PRINT(env.DEBUG_DATA, "GATT SEND MULTI-NTF: %s to %s", ntf.toString().c_str(), toString().c_str());
+    return send(ntf);
+}
+
+bool BTGattHandler::isMultipleHandleValueNtfSupported() noexcept {
+    if( GATTRole::Server != role ) {
+        return false;
+    }
+    return gattServerHandler->isMultipleHandleValueNtfSupported();
+}
+
+uint8_t BTGattHandler::getClientCharConfig(const uint16_t char_value_handle) noexcept {
+    if( GATTRole::Server != role ) {
+        return 0;
+    }
+    return gattServerHandler->getClientCharConfig(char_value_handle);
+}
+
+namespace {
+    struct SyncIndication {
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool done = false;
+        bool confirmed = false;
+    };
 }
 
 bool BTGattHandler::sendIndication(const uint16_t char_value_handle, const jau::TROOctets & value) noexcept {
+    if( std::this_thread::get_id() == l2cap_reader_id ) {
+        // Called from a listener callback on the reader thread, which processes the confirmation: Don't stall it.
+        DBG_PRINT("GATT SEND IND: On reader thread, queued w/o awaiting confirmation: handle %s to %s",
+                jau::to_hexstring(char_value_handle).c_str(), toString().c_str());
+        return sendIndicationAsync(char_value_handle, value);
+    }
+    std::shared_ptr<SyncIndication> sync = std::make_shared<SyncIndication>();
+    const IndicationCallback cb = jau::bindCaptureValueFunc(sync,
+            ( void(*)(std::shared_ptr<SyncIndication>&, const uint16_t, const bool) ) /* help template type deduction of function-ptr */
+                ( [](std::shared_ptr<SyncIndication>& s, const uint16_t h, const bool confirmed) -> void {
+                    (void)h;
+                    std::unique_lock<std::mutex> lock(s->mtx); // RAII-style acquire and relinquish via destructor
+                    s->done = true;
+                    s->confirmed = confirmed;
+                    s->cv.notify_all();
+                  } ) );
+    if( !sendIndicationAsync(char_value_handle, value, cb) ) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(sync->mtx); // RAII-style acquire and relinquish via destructor
+    // Queue completes on confirmation, timeout or disconnect, allow all queued predecessors to time out.
+    const std::chrono::milliseconds max_wait( write_cmd_reply_timeout.to_ms() * ( env.GATT_INDICATION_QUEUE_CAPACITY + 1 ) );
+    if( !sync->cv.wait_for(lock, max_wait, [&sync]{ return sync->done; }) ) {
+        ERR_PRINT("GATT SENT IND: No completion within %" PRIi64 " ms: handle %s to/from %s",
+                static_cast<int64_t>(max_wait.count()), jau::to_hexstring(char_value_handle).c_str(), toString().c_str());
+        return false;
+    }
+    if( !sync->confirmed ) {
+        WARN_PRINT("GATT SENT IND: Failed, no CFM reply: handle %s to/from %s",
+                jau::to_hexstring(char_value_handle).c_str(), toString().c_str());
+    }
+    return sync->confirmed;
+}
+
+bool BTGattHandler::sendIndicationAsync(const uint16_t char_value_handle, const jau::TROOctets & value, const IndicationCallback& callback) noexcept {
     if( GATTRole::Server != role ) {
         ERR_PRINT("GATTRole not server");
         return false;
@@ -862,24 +1028,132 @@ bool BTGattHandler::sendIndication(const uint16_t char_value_handle, const jau::
     }
     if( 0 == value.size() ) {
         COND_PRINT(env.DEBUG_DATA, "GATT SEND IND: Zero size, skipped sending to %s", toString().c_str());
+        if( !callback.isNullType() ) {
+            callback(char_value_handle, true);
+        }
         return true;
     }
-    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
-    AttHandleValueRcv req(false /* isNotify */, char_value_handle, value, usedMTU);
-    std::unique_ptr<const AttPDUMsg> pdu = sendWithReply(req, write_cmd_reply_timeout);
-    if( nullptr == pdu ) {
-        ERR_PRINT2("No reply; req %s from %s", req.toString().c_str(), toString().c_str());
+    if( !is_connected ) {
+        ERR_PRINT("Not connected: handle %s to %s", jau::to_hexstring(char_value_handle).c_str(), toString().c_str());
         return false;
     }
-    if( pdu->getOpcode() == AttPDUMsg::Opcode::HANDLE_VALUE_CFM ) {
-        COND_PRINT(env.DEBUG_DATA, "GATT SENT IND: %s -> %s to/from %s",
-                req.toString().c_str(), pdu->toString().c_str(), toString().c_str());
-        return true;
-    } else {
-        WARN_PRINT("GATT SENT IND: Failed, no CFM reply: %s -> %s to/from %s",
-                req.toString().c_str(), pdu->toString().c_str(), toString().c_str());
-        return false;
+    jau::darray<PendingIndication> done;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_indications); // RAII-style acquire and relinquish via destructor
+        if( indicationQueue.size() >= static_cast<jau::nsize_t>(env.GATT_INDICATION_QUEUE_CAPACITY) ) {
+            WARN_PRINT("GATT SEND IND: Queue full (%zu): handle %s to %s",
+                    indicationQueue.size(), jau::to_hexstring(char_value_handle).c_str(), toString().c_str());
+            return false;
+        }
+        indicationQueue.push_back( PendingIndication { std::make_shared<AttHandleValueRcv>(false /* isNotify */, char_value_handle, value, usedMTU),
+                                                       callback, 0 } );
+        indicationStats.max_depth = std::max(indicationStats.max_depth, indicationQueue.size());
+        if( 1 == indicationQueue.size() ) {
+            sendNextIndicationLocked(done);
+        }
+    }
+    for(PendingIndication& p : done) {
+        if( !p.callback.isNullType() ) {
+            p.callback(p.pdu->getHandle(), false);
+        }
+    }
+    return true;
+}
+
+void BTGattHandler::sendNextIndicationLocked(jau::darray<PendingIndication>& done) noexcept {
+    while( indicationQueue.size() > 0 && 0 == indicationQueue[0].ts_sent ) {
+        indicationQueue[0].ts_sent = jau::getCurrentMilliseconds();
+        const std::shared_ptr<const AttHandleValueRcv> pdu = indicationQueue[0].pdu;
+        COND_PRINT(env.DEBUG_DATA, "GATT SEND IND: %s to %s", pdu->toString().c_str(), toString().c_str());
+        // non-blocking, as called on the reader thread via completeIndication(); a full send queue fails this indication
+        if( sendQueued(*pdu) ) {
+            l2cap.wakeup(); // let the reader wait for the confirmation timeout
+            return;
+        }
+        // sendQueued() may have flushed the queue via disconnect()
+        if( indicationQueue.size() > 0 && indicationQueue[0].pdu == pdu ) {
+            done.push_back( indicationQueue[0] );
+            indicationQueue.erase( indicationQueue.begin() );
+            ++indicationStats.failed;
+        }
+    }
+}
+
+bool BTGattHandler::completeIndication(const bool confirmed) noexcept {
+    jau::darray<PendingIndication> failed;
+    PendingIndication head;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_indications); // RAII-style acquire and relinquish via destructor
+        if( 0 == indicationQueue.size() || 0 == indicationQueue[0].ts_sent ) {
+            return false;
+        }
+        head = indicationQueue[0];
+        indicationQueue.erase( indicationQueue.begin() );
+        if( confirmed ) {
+            ++indicationStats.confirmed;
+            indicationStats.last_rtt_ms = jau::getCurrentMilliseconds() - head.ts_sent;
+        } else {
+            ++indicationStats.failed;
+        }
+        sendNextIndicationLocked(failed);
+    }
+    COND_PRINT(env.DEBUG_DATA, "GATT SENT IND: %s, confirmed %d to/from %s", head.pdu->toString().c_str(), confirmed, toString().c_str());
+    if( !head.callback.isNullType() ) {
+        head.callback(head.pdu->getHandle(), confirmed);
     }
+    for(PendingIndication& p : failed) {
+        if( !p.callback.isNullType() ) {
+            p.callback(p.pdu->getHandle(), false);
+        }
+    }
+    return true;
+}
+
+int32_t BTGattHandler::checkIndicationTimeout() noexcept {
+    const uint64_t timeout_ms = static_cast<uint64_t>( write_cmd_reply_timeout.to_ms() );
+    for(;;) {
+        {
+            const std::lock_guard<std::recursive_mutex> lock(mtx_indications); // RAII-style acquire and relinquish via destructor
+            if( 0 == indicationQueue.size() || 0 == indicationQueue[0].ts_sent ) {
+                return 0; // nothing pending
+            }
+            const uint64_t td = jau::getCurrentMilliseconds() - indicationQueue[0].ts_sent;
+            if( td <= timeout_ms ) {
+                return static_cast<int32_t>( std::min<uint64_t>( std::max<uint64_t>(timeout_ms - td, 1), INT32_MAX ) );
+            }
+        }
+        WARN_PRINT("GATT SENT IND: Failed, no CFM reply within %s; %s",
+                write_cmd_reply_timeout.to_string().c_str(), toString().c_str());
+        completeIndication(false); // sends the next one, if any
+    }
+}
+
+void BTGattHandler::flushIndications() noexcept {
+    jau::darray<PendingIndication> failed;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_indications); // RAII-style acquire and relinquish via destructor
+        failed = indicationQueue;
+        indicationQueue.clear();
+        indicationStats.failed += failed.size();
+    }
+    for(PendingIndication& p : failed) {
+        if( !p.callback.isNullType() ) {
+            p.callback(p.pdu->getHandle(), false);
+        }
+    }
+}
+
+std::string BTGattHandler::IndicationStats::toString() const noexcept {
+    return "IndStats[depth "+std::to_string(depth)+", max "+std::to_string(max_depth)+
+           ", confirmed "+std::to_string(confirmed)+", failed "+std::to_string(failed)+
+           ", last rtt "+std::to_string(last_rtt_ms)+" ms]";
+}
+
+BTGattHandler::IndicationStats BTGattHandler::getIndicationStats() noexcept {
+    const std::lock_guard<std::recursive_mutex> lock(mtx_indications); // RAII-style acquire and relinquish via destructor
+    IndicationStats res = indicationStats;
+    res.depth = indicationQueue.size();
+    return res;
 }
 
 BTGattCharRef BTGattHandler::findCharacterisicsByValueHandle(const jau::darray<BTGattServiceRef> &services_, const uint16_t charValueHandle) noexcept {
@@ -970,7 +1244,7 @@ bool BTGattHandler::discoverCompletePrimaryServices(std::shared_ptr<BTGattHandle
         if( !discoverCharacteristics(primSrv) ) {
             return false;
         }
-        if( primSrv->characteristicList.size() > 0 ) {
+        if( !env.GATT_LAZY_DESCRIPTOR_DISCOVERY && primSrv->characteristicList.size() > 0 ) {
             if( !discoverDescriptors(primSrv) ) {
                 return false;
             }
@@ -1119,89 +1393,159 @@ bool BTGattHandler::discoverDescriptors(BTGattServiceRef & service) noexcept {
      * <p>
      * BT Core Spec v5.2: Vol 3, Part G GATT: 3.3.1 Characteristic Declaration Attribute Value
      * </p>
+     * <p>
+     * Instead of one ATT_FIND_INFORMATION_REQ sequence per characteristic,
+     * the whole service range following the first characteristic value handle is requested.
+     * Returned characteristic declaration and value attributes are skipped
+     * and each descriptor is assigned to its characteristic by handle range.
+     * One response covers up to `(usedMTU-2)/4` attributes, saving round-trips for services with many characteristics.
+     * </p>
      */
-    COND_PRINT(env.DEBUG_DATA, "GATT discoverDescriptors Service: %s on %s", service->toString().c_str(), toString().c_str());
-    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
-    PERF_TS_T0();
+    return discoverDescriptors(service, 0, service->characteristicList.size());
+}
 
+bool BTGattHandler::discoverDescriptors(BTGattChar & charDecl) noexcept {
+    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
+    if( charDecl.descriptorsDiscovered ) {
+        return true;
+    }
+    BTGattServiceRef service = charDecl.getServiceUnchecked();
+    if( nullptr == service ) {
+        ERR_PRINT("Characteristic's service null: %s", charDecl.toString().c_str());
+        return false;
+    }
     const int charCount = service->characteristicList.size();
     for(int charIter=0; charIter < charCount; charIter++ ) {
-        BTGattCharRef charDecl = service->characteristicList[charIter];
-        charDecl->clearDescriptors();
-        COND_PRINT(env.DEBUG_DATA, "GATT discoverDescriptors Characteristic[%d/%d]: %s on %s", charIter, charCount, charDecl->toString().c_str(), toString().c_str());
-
-        uint16_t cd_handle_iter = charDecl->value_handle + 1; // Start @ Characteristic Value Handle + 1
-        uint16_t cd_handle_end;
-        if( charIter+1 < charCount ) {
-            cd_handle_end = service->characteristicList.at(charIter+1)->handle - 1; // // Next Characteristic Handle (excluding)
-        } else {
-            cd_handle_end = service->end_handle; // End of service handle (including)
+        if( charDecl == *service->characteristicList[charIter] ) {
+            return discoverDescriptors(service, charIter, charIter+1) && charDecl.descriptorsDiscovered;
         }
+    }
+    ERR_PRINT("Characteristic not in service: char%s, service%s", charDecl.toString().c_str(), service->toString().c_str());
+    return false;
+}
 
-        bool done=false;
+bool BTGattHandler::discoverDescriptors(BTGattServiceRef & service, const int charBegin, const int charEnd) noexcept {
+    COND_PRINT(env.DEBUG_DATA, "GATT discoverDescriptors Service: chars [%d..%d[, %s on %s", charBegin, charEnd, service->toString().c_str(), toString().c_str());
+    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
+    PERF_TS_T0();
 
-        while( !done && cd_handle_iter <= cd_handle_end ) {
-            const AttFindInfoReq req(cd_handle_iter, cd_handle_end);
-            COND_PRINT(env.DEBUG_DATA, "GATT CD discover send: %s", req.toString().c_str());
+    const int charCount = service->characteristicList.size();
+    if( charBegin >= charEnd ) {
+        return true;
+    }
+    int charIter = charBegin;
+    uint16_t cd_handle_iter = service->characteristicList[charBegin]->value_handle + 1; // Start @ first Characteristic Value Handle + 1
+    uint16_t cd_handle_end;
+    if( charEnd < charCount ) {
+        cd_handle_end = service->characteristicList[charEnd]->handle - 1; // Next Characteristic Handle (excluding)
+    } else {
+        cd_handle_end = service->end_handle; // End of service handle (including)
+    }
 
-            std::unique_ptr<const AttPDUMsg> pdu = sendWithReply(req, read_cmd_reply_timeout);
-            if( nullptr == pdu ) {
-                ERR_PRINT2("No reply; req %s from %s", req.toString().c_str(), toString().c_str());
-                return false;
-            }
-            COND_PRINT(env.DEBUG_DATA, "GATT CD discover recv: %s from ", pdu->toString().c_str(), toString().c_str());
-
-            if( pdu->getOpcode() == AttPDUMsg::Opcode::FIND_INFORMATION_RSP ) {
-                const AttFindInfoRsp * p = static_cast<const AttFindInfoRsp*>(pdu.get());
-                const int e_count = p->getElementCount();
-
-                for(int e_iter=0; e_iter<e_count; e_iter++) {
-                    // handle: handle of Characteristic Descriptor.
-                    // value: Characteristic Descriptor UUID.
-                    const uint16_t cd_handle = p->getElementHandle(e_iter);
-                    std::unique_ptr<const jau::uuid_t> cd_uuid = p->getElementValue(e_iter);
-
-                    std::shared_ptr<BTGattDesc> cd( std::make_shared<BTGattDesc>(charDecl, std::move(cd_uuid), cd_handle) );
-                    if( cd_handle <= charDecl->value_handle || cd_handle > cd_handle_end ) { // should never happen!
-                        ERR_PRINT("GATT discoverDescriptors CD handle %s not in range ]%s..%s]: descr%s within char%s on %s",
-                                jau::to_hexstring(cd_handle).c_str(),
-                                jau::to_hexstring(charDecl->value_handle).c_str(), jau::to_hexstring(cd_handle_end).c_str(),
-                                cd->toString().c_str(), charDecl->toString().c_str(), toString().c_str());
-                        done = true;
-                        break;
+    // Descriptor lists built aside, published only to characteristics not yet discovered.
+    // A published descriptorList is never modified, as lock-free readers may iterate it.
+    struct DescList {
+        jau::darray<BTGattDescRef> list;
+        int clientCharConfigIndex = -1;
+        int userDescriptionIndex = -1;
+    };
+    std::vector<DescList> desc_lists(charEnd - charBegin);
+    bool done=false;
+    bool swept=false; // whole handle range covered
+    bool res=true;
 
-                    }
-                    if( !readDescriptorValue(*cd, 0) ) {
-                        WORDY_PRINT("GATT discoverDescriptors readDescriptorValue failed: req %s, descr%s within char%s on %s",
-                                   req.toString().c_str(), cd->toString().c_str(), charDecl->toString().c_str(), toString().c_str());
-                        done = true;
-                        break;
-                    }
-                    if( cd->isClientCharConfig() ) {
-                        charDecl->clientCharConfigIndex = charDecl->descriptorList.size();
-                    } else if( cd->isUserDescription() ) {
-                        charDecl->userDescriptionIndex = charDecl->descriptorList.size();
-                    }
-                    charDecl->descriptorList.push_back(cd);
-                    COND_PRINT(env.DEBUG_DATA, "GATT CD discovered[%d/%d]: %s", e_iter, e_count, cd->toString().c_str());
+    while( !done && cd_handle_iter <= cd_handle_end ) {
+        const AttFindInfoReq req(cd_handle_iter, cd_handle_end);
+        COND_PRINT(env.DEBUG_DATA, "GATT CD discover send: %s", req.toString().c_str());
+
+        std::unique_ptr<const AttPDUMsg> pdu = sendWithReply(req, read_cmd_reply_timeout);
+        if( nullptr == pdu ) {
+            ERR_PRINT2("No reply; req %s from %s", req.toString().c_str(), toString().c_str());
+            res = false;
+            break;
+        }
+        COND_PRINT(env.DEBUG_DATA, "GATT CD discover recv: %s from %s", pdu->toString().c_str(), toString().c_str());
+
+        if( pdu->getOpcode() == AttPDUMsg::Opcode::FIND_INFORMATION_RSP ) {
+            const AttFindInfoRsp * p = static_cast<const AttFindInfoRsp*>(pdu.get());
+            const int e_count = p->getElementCount();
+
+            for(int e_iter=0; e_iter<e_count; e_iter++) {
+                // handle: handle of Characteristic Descriptor, Declaration or Value.
+                // value: Attribute Type UUID.
+                const uint16_t cd_handle = p->getElementHandle(e_iter);
+                if( cd_handle < cd_handle_iter || cd_handle > cd_handle_end ) { // should never happen!
+                    ERR_PRINT("GATT discoverDescriptors CD handle %s not in range [%s..%s] within service%s on %s",
+                            jau::to_hexstring(cd_handle).c_str(),
+                            jau::to_hexstring(cd_handle_iter).c_str(), jau::to_hexstring(cd_handle_end).c_str(),
+                            service->toString().c_str(), toString().c_str());
+                    done = true;
+                    break;
+                }
+                // Next Characteristic Handle starts the next descriptor range
+                while( charIter+1 < charEnd && cd_handle >= service->characteristicList[charIter+1]->handle ) {
+                    ++charIter;
+                }
+                BTGattCharRef charDecl = service->characteristicList[charIter];
+                if( cd_handle <= charDecl->value_handle ) {
+                    // Characteristic Declaration or Value
+                    continue;
                 }
-                cd_handle_iter = p->getElementHandle(e_count-1); // Last Descriptor Handle
+                DescList& dl = desc_lists[charIter - charBegin];
+                std::shared_ptr<BTGattDesc> cd( std::make_shared<BTGattDesc>(charDecl, p->getElementValue(e_iter), cd_handle) );
+                if( !readDescriptorValue(*cd, 0) ) {
+                    // keep the enumerated descriptor w/ an empty value, it may be read or written later
+                    WORDY_PRINT("GATT discoverDescriptors readDescriptorValue failed: req %s, descr%s within char%s on %s",
+                               req.toString().c_str(), cd->toString().c_str(), charDecl->toString().c_str(), toString().c_str());
+                    cd->value.resize(0);
+                }
+                if( cd->isClientCharConfig() ) {
+                    dl.clientCharConfigIndex = dl.list.size();
+                } else if( cd->isUserDescription() ) {
+                    dl.userDescriptionIndex = dl.list.size();
+                }
+                dl.list.push_back(cd);
+                COND_PRINT(env.DEBUG_DATA, "GATT CD discovered[%d/%d]: %s", e_iter, e_count, cd->toString().c_str());
+            }
+            if( !done ) {
+                cd_handle_iter = p->getElementHandle(e_count-1); // Last Attribute Handle
                 if( cd_handle_iter < cd_handle_end ) {
                     cd_handle_iter++;
                 } else {
                     done = true; // OK by spec: End of communication
+                    swept = true;
                 }
-            } else if( pdu->getOpcode() == AttPDUMsg::Opcode::ERROR_RSP ) {
-                done = true; // OK by spec: End of communication
-            } else {
-                ERR_PRINT("GATT discoverDescriptors unexpected reply %s; req %s within char%s from %s",
-                        pdu->toString().c_str(), req.toString().c_str(), charDecl->toString().c_str(), toString().c_str());
-                done = true;
             }
+        } else if( pdu->getOpcode() == AttPDUMsg::Opcode::ERROR_RSP ) {
+            done = true; // OK by spec: End of communication
+            swept = true;
+        } else {
+            ERR_PRINT("GATT discoverDescriptors unexpected reply %s; req %s within service%s from %s",
+                    pdu->toString().c_str(), req.toString().c_str(), service->toString().c_str(), toString().c_str());
+            done = true;
+        }
+    }
+    // Last handle covered by the sweep, excluding a prematurely ended response
+    const uint16_t covered_end = ( swept || cd_handle_iter > cd_handle_end ) ? cd_handle_end : cd_handle_iter - 1;
+    for(charIter=charBegin; charIter < charEnd; charIter++ ) {
+        const uint16_t char_end = charIter+1 < charCount ? service->characteristicList[charIter+1]->handle - 1 : service->end_handle;
+        BTGattChar& charDecl = *service->characteristicList[charIter];
+        if( charDecl.descriptorsDiscovered ) {
+            continue; // already published, keep it
+        }
+        if( char_end <= covered_end ) {
+            DescList& dl = desc_lists[charIter - charBegin];
+            charDecl.descriptorList = std::move(dl.list);
+            charDecl.clientCharConfigIndex = dl.clientCharConfigIndex;
+            charDecl.userDescriptionIndex = dl.userDescriptionIndex;
+            charDecl.descriptorsDiscovered = true; // after completing its descriptorList
+        } else {
+            DBG_PRINT("GATT discoverDescriptors incomplete, covered until %s: char%s on %s",
+                    jau::to_hexstring(covered_end).c_str(), charDecl.toString().c_str(), toString().c_str());
         }
     }
     PERF_TS_TD("GATT discoverDescriptors");
-    return true;
+    return res;
 }
 
 bool BTGattHandler::readDescriptorValue(BTGattDesc & desc, int expectedLength) noexcept {
@@ -1330,6 +1674,58 @@ bool BTGattHandler::writeCharacteristicValueNoResp(const BTGattChar & c, const j
     return writeValue(c.value_handle, value, false);
 }
 
+bool BTGattHandler::writeCharacteristicValueNoRespStream(const BTGattChar & c, const jau::TROOctets & value, BTGattChar::StreamWriteStats * stats) noexcept {
+    /* BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.1 Write Characteristic Value Without Response */
+    if( value.size() <= 0 ) {
+        WARN_PRINT("GATT writeCharacteristicValueNoRespStream size <= 0, no-op: %s", value.toString().c_str());
+        return false;
+    }
+    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
+
+    // ATT_WRITE_CMD: opcode + handle
+    const jau::nsize_t chunk_size = usedMTU - 3;
+    const uint64_t t0 = jau::getCurrentMilliseconds();
+    BTGattChar::StreamWriteStats s;
+    bool res = true;
+
+    COND_PRINT(env.DEBUG_DATA, "GATT writeCharacteristicValueNoRespStream: size %zu, chunk %zu, char %s",
+            (size_t)value.size(), (size_t)chunk_size, c.toString().c_str());
+
+    while( res && s.bytes < value.size() ) {
+        const jau::nsize_t len = std::min(chunk_size, value.size() - s.bytes);
+        const AttWriteCmd req(c.value_handle, jau::TROOctets(value.get_ptr() + s.bytes, len, value.byte_order()));
+
+        // Reserve twice the PDU size to cover the kernel's socket buffer accounting overhead
+        const jau::snsize_t space = l2cap.getTxQueueSpace();
+        if( 0 <= space && static_cast<jau::nsize_t>(space) < 2 * req.pdu.size() ) {
+            ++s.stall_count;
+            const jau::snsize_t wres = l2cap.waitWritable(write_cmd_reply_timeout);
+            if( 0 > wres ) {
+                ERR_PRINT("GATT writeCharacteristicValueNoRespStream: wait writable res %d (%s) at %zu / %zu; %s",
+                        wres, L2CAPClient::getRWExitCodeString(wres).c_str(), (size_t)s.bytes, (size_t)value.size(), toString().c_str());
+                res = false;
+                break;
+            }
+        }
+        res = send( req );
+        if( res ) {
+            s.bytes += len;
+            ++s.pdu_count;
+        }
+    }
+    s.duration_ms = jau::getCurrentMilliseconds() - t0;
+
+    if( res ) {
+        DBG_PRINT("GATT writeCharacteristicValueNoRespStream: %s, %s", s.toString().c_str(), toString().c_str());
+    } else {
+        ERR_PRINT2("GATT writeCharacteristicValueNoRespStream failed: %s, char %s, %s", s.toString().c_str(), c.toString().c_str(), toString().c_str());
+    }
+    if( nullptr != stats ) {
+        *stats = s;
+    }
+    return res;
+}
+
 bool BTGattHandler::writeValue(const uint16_t handle, const jau::TROOctets & value, const bool withResponse) noexcept {
     /* BT Core Spec v5.2: Vol 3, Part G GATT: 3.3.3.3 Client Characteristic Configuration */
     /* BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.3 Write Characteristic Value */
@@ -1342,7 +1738,9 @@ bool BTGattHandler::writeValue(const uint16_t handle, const jau::TROOctets & val
     }
     const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
 
-    // FIXME TODO: Long Value if value.size() > ( ATT_MTU - 3 )
+    if( withResponse && value.size() > static_cast<jau::nsize_t>( usedMTU - 3 ) ) {
+        return writeValueLong(handle, value);
+    }
     PERF2_TS_T0();
 
     if( !withResponse ) {
@@ -1382,6 +1780,80 @@ bool BTGattHandler::writeValue(const uint16_t handle, const jau::TROOctets & val
     return res;
 }
 
+bool BTGattHandler::writeValueLong(const uint16_t handle, const jau::TROOctets & value) noexcept {
+    /* BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.4 Write Long Characteristic Values */
+    /* BT Core Spec v5.2: Vol 3, Part G GATT: 4.9.5 Reliable Writes */
+    /* BT Core Spec v5.2: Vol 3, Part G GATT: 4.12.4 Write Long Characteristic Descriptors */
+    if( value.size() > 0xffff ) {
+        ERR_PRINT("GATT writeValueLong size %zu > 0xffff: handle %s on %s", (size_t)value.size(), jau::to_hexstring(handle).c_str(), toString().c_str());
+        return false;
+    }
+    const std::lock_guard<std::recursive_mutex> lock(mtx_command); // RAII-style acquire and relinquish via destructor
+    PERF2_TS_T0();
+
+    // ATT_PREPARE_WRITE_REQ: opcode + handle + value_offset
+    const jau::nsize_t chunk_size = usedMTU - 5;
+    jau::nsize_t offset = 0;
+    bool verified = true;
+
+    while( verified && offset < value.size() ) {
+        const jau::nsize_t len = std::min(chunk_size, value.size() - offset);
+        const AttPrepWrite req(true /* isReq */, handle, jau::TROOctets(value.get_ptr() + offset, len, value.byte_order()), static_cast<uint16_t>(offset));
+        COND_PRINT(env.DEBUG_DATA, "GATT WVL send: %s to %s", req.toString().c_str(), toString().c_str());
+
+        std::unique_ptr<const AttPDUMsg> pdu = sendWithReply(req, write_cmd_reply_timeout);
+        if( nullptr == pdu ) {
+            // Prepared chunks may have been queued by the server, cancel them below
+            ERR_PRINT2("No reply; req %s from %s", req.toString().c_str(), toString().c_str());
+            verified = false;
+            break;
+        }
+        COND_PRINT(env.DEBUG_DATA, "GATT WVL recv: %s from %s", pdu->toString().c_str(), toString().c_str());
+
+        if( pdu->getOpcode() == AttPDUMsg::Opcode::PREPARE_WRITE_RSP ) {
+            // Reliable write: Response echoes handle, offset and value, verify before executing
+            const AttPrepWrite * p = static_cast<const AttPrepWrite*>(pdu.get());
+            if( p->getHandle() != handle || p->getValueOffset() != offset ||
+                p->getValue().size() != len || 0 != ::memcmp(p->getValuePtr(), req.getValuePtr(), len) )
+            {
+                WARN_PRINT("GATT writeValueLong verification failed %s; req %s from %s", p->toString().c_str(), req.toString().c_str(), toString().c_str());
+                verified = false;
+            } else {
+                offset += len;
+            }
+        } else if( pdu->getOpcode() == AttPDUMsg::Opcode::ERROR_RSP ) {
+            WORDY_PRINT("GATT writeValueLong unexpected error %s; req %s from %s", pdu->toString().c_str(), req.toString().c_str(), toString().c_str());
+            verified = false;
+        } else {
+            ERR_PRINT("GATT writeValueLong unexpected reply %s; req %s from %s", pdu->toString().c_str(), req.toString().c_str(), toString().c_str());
+            verified = false;
+        }
+    }
+
+    // Execute (0x01) all prepared writes if verified, otherwise cancel (0x00) them on every error path,
+    // i.e. missing, erroneous or mismatching ATT_PREPARE_WRITE_RSP.
+    // A cancel after a disconnect fails in send(), while the server has discarded its queue already.
+    const AttExeWriteReq req(verified ? 0x01 : 0x00);
+    COND_PRINT(env.DEBUG_DATA, "GATT WVL send: %s to %s", req.toString().c_str(), toString().c_str());
+
+    std::unique_ptr<const AttPDUMsg> pdu = sendWithReply(req, write_cmd_reply_timeout);
+    PERF2_TS_TD("GATT writeValueLong");
+    if( nullptr == pdu ) {
+        ERR_PRINT2("No reply; req %s from %s", req.toString().c_str(), toString().c_str());
+        return false;
+    }
+    COND_PRINT(env.DEBUG_DATA, "GATT WVL recv: %s from %s", pdu->toString().c_str(), toString().c_str());
+
+    if( pdu->getOpcode() == AttPDUMsg::Opcode::EXECUTE_WRITE_RSP ) {
+        return verified;
+    } else if( pdu->getOpcode() == AttPDUMsg::Opcode::ERROR_RSP ) {
+        WORDY_PRINT("GATT writeValueLong unexpected error %s; req %s from %s", pdu->toString().c_str(), req.toString().c_str(), toString().c_str());
+    } else {
+        ERR_PRINT("GATT writeValueLong unexpected reply %s; req %s from %s", pdu->toString().c_str(), req.toString().c_str(), toString().c_str());
+    }
+    return false;
+}
+
 bool BTGattHandler::configNotificationIndication(BTGattDesc & cccd, const bool enableNotification, const bool enableIndication) noexcept {
     if( !cccd.isClientCharConfig() ) {
         ERR_PRINT("Not a ClientCharacteristicConfiguration: %s", cccd.toString().c_str());
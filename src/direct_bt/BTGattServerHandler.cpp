@@ -26,6 +26,10 @@
 #include <string>
 #include <memory>
 #include <cstdint>
+#include <unordered_map>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
 #include <cstdio>
 
 #include  <algorithm>
@@ -73,6 +77,11 @@ class NopGattServerHandler : public BTGattHandler::GattServerHandler {
             return true;
         }
 
+        bool replyReadMultipleReq(const AttReadMultipleReq * pdu) noexcept override {
+            (void)pdu;
+            return true;
+        }
+
         bool replyWriteReq(const AttPDUMsg * pdu) noexcept override {
             (void)pdu;
             return true;
@@ -107,29 +116,83 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
         jau::darray<AttPrepWrite> writeDataQueue;
         jau::darray<uint16_t> writeDataQueueHandles;
 
+        /** Per connection Client Characteristic Configuration bits, indexed by characteristic value handle. */
+        jau::POctets clientCharConfigs;
+
+        /** Per connection values of DBGattChar::hasPerConnectionValue(), keyed by characteristic value handle. */
+        std::unordered_map<uint16_t, std::shared_ptr<jau::POctets>> clientValues;
+
+        /** Value handle of the optional GattCharacteristicType::CLIENT_SUPPORTED_FEATURES characteristic, zero if not available. */
+        uint16_t clientSupportedFeaturesHandle;
+
+        /** Client Supported Features bit 2, updated on the reader thread when written by this connection's client. */
+        std::atomic<bool> multipleHandleValueNtfSupported;
+
     public:
         DBGattServerHandler(BTGattHandler& gh_, DBGattServerRef gsd) noexcept
-        : gh(gh_), gattServerData(gsd) {}
+        : gh(gh_), gattServerData(gsd),
+          clientCharConfigs(gsd->getAttributeEndHandle()+1, jau::endian::little),
+          clientSupportedFeaturesHandle(0), multipleHandleValueNtfSupported(false)
+        {
+            clientCharConfigs.bzero();
+            const jau::uuid16_t uuid_csf = jau::uuid16_t(GattCharacteristicType::CLIENT_SUPPORTED_FEATURES);
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            for(int h = 1; h <= DBGattServer::getAttributeEndHandle(*table); ++h) {
+                const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, static_cast<uint16_t>(h));
+                if( nullptr != a && DBGattServer::Attribute::Type::CHAR_VALUE == a->type &&
+                    a->characteristic->getValueType()->equivalent(uuid_csf) )
+                {
+                    clientSupportedFeaturesHandle = static_cast<uint16_t>(h);
+                    break;
+                }
+            }
+        }
+
+        bool isMultipleHandleValueNtfSupported() noexcept override {
+            return multipleHandleValueNtfSupported;
+        }
+
+        uint8_t getClientCharConfig(const uint16_t char_value_handle) noexcept override {
+            if( char_value_handle >= clientCharConfigs.size() ) {
+                return 0;
+            }
+            return clientCharConfigs.get_uint8_nc(char_value_handle);
+        }
 
     private:
+        /** Returns this connection's own value of DBGattChar::hasPerConnectionValue(), created as a copy of the shared value. */
+        std::shared_ptr<jau::POctets> getClientValue(const DBGattCharRef& c) noexcept {
+            auto it = clientValues.find(c->getValueHandle());
+            if( clientValues.end() != it ) {
+                return it->second;
+            }
+            const DBGattValueRef snapshot = c->getValueSnapshot();
+            const jau::POctets& src = nullptr != snapshot ? *snapshot : c->getValue();
+            std::shared_ptr<jau::POctets> v = std::make_shared<jau::POctets>(src, std::max(src.capacity(), c->getValue().capacity()));
+            clientValues[c->getValueHandle()] = v;
+            return v;
+        }
+
+        /**
+         * Returns the value to be read by this connection's client,
+         * i.e. its own value, the published snapshot or `nullptr` for the shared DBGattChar::getValue().
+         */
+        DBGattValueRef getReadValue(const DBGattCharRef& c) noexcept {
+            if( c->hasPerConnectionValue() ) {
+                auto it = clientValues.find(c->getValueHandle());
+                if( clientValues.end() != it ) {
+                    return it->second;
+                }
+            }
+            return c->getValueSnapshot();
+        }
+
         bool hasServerHandle(const uint16_t handle) noexcept {
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                if( s->getHandle() <= handle && handle <= s->getEndHandle() ) {
-                    for(DBGattCharRef& c : s->getCharacteristics()) {
-                        if( c->getHandle() <= handle && handle <= c->getEndHandle() ) {
-                            if( handle == c->getValueHandle() ) {
-                                return true;
-                            }
-                            for(DBGattDescRef& d : c->getDescriptors()) {
-                                if( handle == d->getHandle() ) {
-                                    return true;
-                                }
-                            }
-                        } // if characteristics-range
-                    } // for characteristics
-                } // if service-range
-            } // for services
-            return false;
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, handle);
+            return nullptr != a &&
+                   ( DBGattServer::Attribute::Type::CHAR_VALUE == a->type ||
+                     DBGattServer::Attribute::Type::DESC == a->type );
         }
 
         DBGattCharRef findServerGattCharByValueHandle(const uint16_t char_value_handle) noexcept {
@@ -137,186 +200,230 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
         }
 
         AttErrorRsp::ErrorCode applyWrite(BTDeviceRef device, const uint16_t handle, const jau::TROOctets & value, const uint16_t value_offset) noexcept {
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                if( s->getHandle() <= handle && handle <= s->getEndHandle() ) {
-                    for(DBGattCharRef& c : s->getCharacteristics()) {
-                        if( c->getHandle() <= handle && handle <= c->getEndHandle() ) {
-                            if( handle == c->getValueHandle() ) {
-                                if( c->getValue().size() < value_offset) { // offset at value-end + 1 OK to append
-                                    return AttErrorRsp::ErrorCode::INVALID_OFFSET;
-                                }
-                                if( c->hasVariableLength() ) {
-                                    if( c->getValue().capacity() < value_offset + value.size() ) {
-                                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
-                                    }
-                                } else {
-                                    if( c->getValue().size() < value_offset + value.size() ) {
-                                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
-                                    }
-                                }
-                                {
-                                    bool allowed = true;
-                                    int i=0;
-                                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                        try {
-                                            allowed = l->writeCharValue(device, s, c, value, value_offset) && allowed;
-                                        } catch (std::exception &e) {
-                                            ERR_PRINT("GATT-REQ: WRITE: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                    device->toString().c_str(), e.what());
-                                        }
-                                        i++;
-                                    });
-                                    if( !allowed ) {
-                                        return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
-                                    }
-                                }
-                                if( c->hasVariableLength() ) {
-                                    if( c->getValue().size() != value_offset + value.size() ) {
-                                        c->getValue().resize( value_offset + value.size() );
-                                    }
-                                }
-                                c->getValue().put_octets_nc(value_offset, value);
-                                return AttErrorRsp::ErrorCode::NO_ERROR;
-                            }
-                            for(DBGattDescRef& d : c->getDescriptors()) {
-                                if( handle == d->getHandle() ) {
-                                    if( d->getValue().size() < value_offset) { // offset at value-end + 1 OK to append
-                                        return AttErrorRsp::ErrorCode::INVALID_OFFSET;
-                                    }
-                                    if( d->hasVariableLength() ) {
-                                        if( d->getValue().capacity() < value_offset + value.size() ) {
-                                            return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
-                                        }
-                                    } else {
-                                        if( d->getValue().size() < value_offset + value.size() ) {
-                                            return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
-                                        }
-                                    }
-                                    if( d->isUserDescription() ) {
-                                        return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
-                                    }
-                                    const bool isCCCD = d->isClientCharConfig();
-                                    if( !isCCCD ) {
-                                        bool allowed = true;
-                                        int i=0;
-                                        jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                            try {
-                                                allowed = l->writeDescValue(device, s, c, d, value, value_offset) && allowed;
-                                            } catch (std::exception &e) {
-                                                ERR_PRINT("GATT-REQ: WRITE: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                        d->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                        device->toString().c_str(), e.what());
-                                            }
-                                            i++;
-                                        });
-                                        if( !allowed ) {
-                                            return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
-                                        }
-                                    }
-                                    if( d->hasVariableLength() ) {
-                                        if( d->getValue().size() != value_offset + value.size() ) {
-                                            d->getValue().resize( value_offset + value.size() );
-                                        }
-                                    }
-                                    if( isCCCD ) {
-                                        if( value.size() == 0 ) {
-                                            // no change, exit
-                                            return AttErrorRsp::ErrorCode::NO_ERROR;
-                                        }
-                                        const uint8_t old_v = d->getValue().get_uint8_nc(0);
-                                        const bool oldEnableNotification = old_v & 0b001;
-                                        const bool oldEnableIndication = old_v & 0b010;
-
-                                        const uint8_t req_v = value.get_uint8_nc(0);
-                                        const bool reqEnableNotification = req_v & 0b001;
-                                        const bool reqEnableIndication = req_v & 0b010;
-                                        const bool hasNotification = c->hasProperties(BTGattChar::PropertyBitVal::Notify);
-                                        const bool hasIndication = c->hasProperties(BTGattChar::PropertyBitVal::Indicate);
-                                        const bool enableNotification = reqEnableNotification && hasNotification;
-                                        const bool enableIndication = reqEnableIndication && hasIndication;
-
-                                        if( oldEnableNotification == enableNotification &&
-                                            oldEnableIndication == enableIndication ) {
-                                            // no change, exit
-                                            return AttErrorRsp::ErrorCode::NO_ERROR;
-                                        }
-                                        const uint16_t new_v = enableNotification | ( enableIndication << 1 );
-                                        d->getValue().put_uint8_nc(0, new_v);
-                                        {
-                                            int i=0;
-                                            jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                                try {
-                                                    l->clientCharConfigChanged(device, s, c, d, enableNotification, enableIndication);
-                                                } catch (std::exception &e) {
-                                                    ERR_PRINT("GATT-REQ: WRITE CCCD: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                            d->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                            device->toString().c_str(), e.what());
-                                                }
-                                                i++;
-                                            });
-                                        }
-                                    } else {
-                                        // all other types ..
-                                        d->getValue().put_octets_nc(value_offset, value);
-                                    }
-                                    return AttErrorRsp::ErrorCode::NO_ERROR;
-                                }
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, handle);
+            if( nullptr != a && DBGattServer::Attribute::Type::CHAR_VALUE == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                // Target value: this connection's own value, a copy-on-write of the published snapshot or the shared value
+                std::shared_ptr<jau::POctets> target = nullptr;
+                if( c->hasPerConnectionValue() ) {
+                    target = getClientValue(c);
+                } else {
+                    const DBGattValueRef snapshot = c->getValueSnapshot();
+                    if( nullptr != snapshot ) {
+                        target = std::make_shared<jau::POctets>(*snapshot, std::max(snapshot->capacity(), c->getValue().capacity()));
+                    }
+                }
+                jau::POctets& v = nullptr != target ? *target : c->getValue();
+                if( v.size() < value_offset) { // offset at value-end + 1 OK to append
+                    return AttErrorRsp::ErrorCode::INVALID_OFFSET;
+                }
+                if( c->hasVariableLength() ) {
+                    if( v.capacity() < value_offset + value.size() ) {
+                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
+                    }
+                } else {
+                    if( v.size() < value_offset + value.size() ) {
+                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
+                    }
+                }
+                {
+                    bool allowed = true;
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->writeCharValue(device, s, c, value, value_offset) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: WRITE: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                    if( !allowed ) {
+                        return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
+                    }
+                }
+                if( c->hasVariableLength() ) {
+                    if( v.size() != value_offset + value.size() ) {
+                        v.resize( value_offset + value.size() );
+                    }
+                }
+                v.put_octets_nc(value_offset, value);
+                if( nullptr != target && !c->hasPerConnectionValue() ) {
+                    c->publishValueSnapshot(target); // last writer wins
+                }
+                return AttErrorRsp::ErrorCode::NO_ERROR;
+            } else if( nullptr != a && DBGattServer::Attribute::Type::DESC == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                const DBGattDescRef& d = a->descriptor;
+                // Target value: a copy-on-write of the published snapshot or the shared value
+                const DBGattValueRef snapshot = d->isClientCharConfig() ? nullptr : d->getValueSnapshot();
+                std::shared_ptr<jau::POctets> target = nullptr != snapshot ?
+                        std::make_shared<jau::POctets>(*snapshot, std::max(snapshot->capacity(), d->getValue().capacity())) : nullptr;
+                jau::POctets& v = nullptr != target ? *target : d->getValue();
+                if( v.size() < value_offset) { // offset at value-end + 1 OK to append
+                    return AttErrorRsp::ErrorCode::INVALID_OFFSET;
+                }
+                if( d->hasVariableLength() ) {
+                    if( v.capacity() < value_offset + value.size() ) {
+                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
+                    }
+                } else {
+                    if( v.size() < value_offset + value.size() ) {
+                        return AttErrorRsp::ErrorCode::INVALID_ATTRIBUTE_VALUE_LEN;
+                    }
+                }
+                if( d->isUserDescription() ) {
+                    return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
+                }
+                const bool isCCCD = d->isClientCharConfig();
+                if( !isCCCD ) {
+                    bool allowed = true;
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->writeDescValue(device, s, c, d, value, value_offset) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: WRITE: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    d->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                    if( !allowed ) {
+                        return AttErrorRsp::ErrorCode::NO_WRITE_PERM;
+                    }
+                }
+                if( !isCCCD && d->hasVariableLength() ) {
+                    if( v.size() != value_offset + value.size() ) {
+                        v.resize( value_offset + value.size() );
+                    }
+                }
+                if( isCCCD ) {
+                    if( value.size() == 0 ) {
+                        // no change, exit
+                        return AttErrorRsp::ErrorCode::NO_ERROR;
+                    }
+                    if( c->getValueHandle() >= clientCharConfigs.size() ) {
+                        return AttErrorRsp::ErrorCode::INVALID_HANDLE;
+                    }
+                    // per connection state, the shared DBGattDesc value is not modified
+                    const uint8_t old_v = clientCharConfigs.get_uint8_nc(c->getValueHandle());
+                    const bool oldEnableNotification = old_v & 0b001;
+                    const bool oldEnableIndication = old_v & 0b010;
+
+                    const uint8_t req_v = value.get_uint8_nc(0);
+                    const bool reqEnableNotification = req_v & 0b001;
+                    const bool reqEnableIndication = req_v & 0b010;
+                    const bool hasNotification = c->hasProperties(BTGattChar::PropertyBitVal::Notify);
+                    const bool hasIndication = c->hasProperties(BTGattChar::PropertyBitVal::Indicate);
+                    const bool enableNotification = reqEnableNotification && hasNotification;
+                    const bool enableIndication = reqEnableIndication && hasIndication;
+
+                    if( oldEnableNotification == enableNotification &&
+                        oldEnableIndication == enableIndication ) {
+                        // no change, exit
+                        return AttErrorRsp::ErrorCode::NO_ERROR;
+                    }
+                    const uint16_t new_v = enableNotification | ( enableIndication << 1 );
+                    clientCharConfigs.put_uint8_nc(c->getValueHandle(), new_v);
+                    {
+                        int i=0;
+                        jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                            try {
+                                l->clientCharConfigChanged(device, s, c, d, enableNotification, enableIndication);
+                            } catch (std::exception &e) {
+                                ERR_PRINT("GATT-REQ: WRITE CCCD: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                        d->toString().c_str(), i+1, gattServerData->listener().size(),
+                                        device->toString().c_str(), e.what());
                             }
-                        } // if characteristics-range
-                    } // for characteristics
-                } // if service-range
-            } // for services
+                            i++;
+                        });
+                    }
+                } else {
+                    // all other types ..
+                    v.put_octets_nc(value_offset, value);
+                    if( nullptr != target ) {
+                        d->publishValueSnapshot(target); // last writer wins
+                    }
+                }
+                return AttErrorRsp::ErrorCode::NO_ERROR;
+            }
             return AttErrorRsp::ErrorCode::INVALID_HANDLE;
         }
 
+        /**
+         * Sends an ATT_READ_RSP or ATT_READ_BLOB_RSP of the given value starting at value_offset
+         * via a scatter-gather write, i.e. without copying the value into an AttReadNRsp.
+         *
+         * BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.4 ATT_READ_RSP and 3.4.4.6 ATT_READ_BLOB_RSP
+         */
+        bool sendReadRsp(const AttPDUMsg * pdu, const bool isBlobReq, const DBGattValueRef& value, const jau::nsize_t value_offset) noexcept {
+            const uint8_t opc = AttPDUMsg::number( isBlobReq ? AttPDUMsg::Opcode::READ_BLOB_RSP : AttPDUMsg::Opcode::READ_RSP );
+            const jau::nsize_t value_size = std::min<jau::nsize_t>(gh.getUsedMTU()-1, value->size() - value_offset); // more requires another READ_BLOB_REQ
+            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.Z: %s -> opcode %s, value size %zu/%zu from %s", pdu->toString().c_str(),
+                    jau::to_hexstring(opc).c_str(), value_size, value->size(), gh.toString().c_str());
+            return gh.sendScattered(&opc, 1, value->get_ptr() + value_offset, value_size);
+        }
+
+        /** Caches the given immutable discovery response in the DBGattServer before sending it. */
+        bool sendAndCache(const uint64_t cacheKey, const AttPDUMsg& rsp) noexcept {
+            gattServerData->putCachedResponse(cacheKey, rsp);
+            return gh.send(rsp);
+        }
+
         void signalWriteDone(BTDeviceRef device, const uint16_t handle) noexcept {
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                if( s->getHandle() <= handle && handle <= s->getEndHandle() ) {
-                    for(DBGattCharRef& c : s->getCharacteristics()) {
-                        if( c->getHandle() <= handle && handle <= c->getEndHandle() ) {
-                            if( handle == c->getValueHandle() ) {
-                                {
-                                    int i=0;
-                                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                        try {
-                                            l->writeCharValueDone(device, s, c);
-                                        } catch (std::exception &e) {
-                                            ERR_PRINT("GATT-REQ: WRITE-Done: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                    device->toString().c_str(), e.what());
-                                        }
-                                        i++;
-                                    });
-                                }
-                                return;
-                            }
-                            for(DBGattDescRef& d : c->getDescriptors()) {
-                                if( handle == d->getHandle() ) {
-                                    if( d->isUserDescription() ) {
-                                        return;
-                                    }
-                                    const bool isCCCD = d->isClientCharConfig();
-                                    if( !isCCCD ) {
-                                        int i=0;
-                                        jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                            try {
-                                                l->writeDescValueDone(device, s, c, d);
-                                            } catch (std::exception &e) {
-                                                ERR_PRINT("GATT-REQ: WRITE-Done: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                        d->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                        device->toString().c_str(), e.what());
-                                            }
-                                            i++;
-                                        });
-                                    }
-                                    return;
-                                }
-                            }
-                        } // if characteristics-range
-                    } // for characteristics
-                } // if service-range
-            } // for services
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, handle);
+            if( nullptr != a && DBGattServer::Attribute::Type::CHAR_VALUE == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                if( 0 != clientSupportedFeaturesHandle && clientSupportedFeaturesHandle == handle ) {
+                    // BT Core Spec v5.2: Vol 3, Part G GATT: 7.2 Client Supported Features, bit 2: Multiple Handle Value Notifications
+                    const DBGattValueRef value = getReadValue(c);
+                    const jau::TROOctets& v = nullptr != value ? *value : c->getValue();
+                    multipleHandleValueNtfSupported = 0 < v.size() && 0 != ( v.get_uint8_nc(0) & 0b100 );
+                }
+                {
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            l->writeCharValueDone(device, s, c);
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: WRITE-Done: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                }
+                return;
+            } else if( nullptr != a && DBGattServer::Attribute::Type::DESC == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                const DBGattDescRef& d = a->descriptor;
+                if( d->isUserDescription() ) {
+                    return;
+                }
+                const bool isCCCD = d->isClientCharConfig();
+                if( !isCCCD ) {
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            l->writeDescValueDone(device, s, c, d);
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: WRITE-Done: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    d->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                }
+                return;
+            }
             return;
         }
 
@@ -341,6 +448,9 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
             }
             writeDataQueue.clear();
             writeDataQueueHandles.clear();
+            clientCharConfigs.bzero();
+            clientValues.clear();
+            multipleHandleValueNtfSupported = false;
         }
 
         DBGattServer::Mode getMode() noexcept override { return DBGattServer::Mode::DB; }
@@ -528,109 +638,226 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
             const jau::nsize_t rspMaxSize = gh.getUsedMTU()-1;
             (void)rspMaxSize;
 
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                if( s->getHandle() <= handle && handle <= s->getEndHandle() ) {
-                    /**
-                     * AttReadByGroupTypeRsp (1 opcode + 1 element_size + 2 handle + 2 handle + 16 uuid128_t = 22 bytes)
-                     * always fits in minimum ATT_PDU 23
-                     */
-                    for(DBGattCharRef& c : s->getCharacteristics()) {
-                        if( c->getHandle() <= handle && handle <= c->getEndHandle() ) {
-                            if( handle == c->getValueHandle() ) {
-                                if( isBlobReq ) {
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, handle);
+            if( nullptr != a && DBGattServer::Attribute::Type::CHAR_VALUE == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                DBGattValueRef value = getReadValue(c);
+                if( isBlobReq ) {
 #if SEND_ATTRIBUTE_NOT_LONG
-                                    if( c->getValue().size() <= rspMaxSize ) {
-                                        AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_LONG, pdu->getOpcode(), handle);
-                                        COND_PRINT(env.DEBUG_DATA, "GATT-Req: READ.0: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), toString().c_str());
-                                        gh.send(err);
-                                        return;
-                                    }
+                    if( ( nullptr != value ? *value : c->getValue() ).size() <= rspMaxSize ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_LONG, pdu->getOpcode(), handle);
+                        COND_PRINT(env.DEBUG_DATA, "GATT-Req: READ.0: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), toString().c_str());
+                        gh.send(err);
+                        return;
+                    }
 #endif
-                                    if( value_offset > c->getValue().size() ) {
-                                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
-                                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                                        return gh.send(err);
-                                    }
-                                }
-                                {
-                                    bool allowed = true;
-                                    int i=0;
-                                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                        try {
-                                            allowed = l->readCharValue(device, s, c) && allowed;
-                                        } catch (std::exception &e) {
-                                            ERR_PRINT("GATT-REQ: READ: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                    device->toString().c_str(), e.what());
-                                        }
-                                        i++;
-                                    });
-                                    if( !allowed ) {
-                                        AttErrorRsp err(AttErrorRsp::ErrorCode::NO_READ_PERM, pdu->getOpcode(), handle);
-                                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.2: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                                        return gh.send(err);
-                                    }
-                                }
-                                AttReadNRsp rsp(isBlobReq, c->getValue(), value_offset); // Blob: value_size == value_offset -> OK, ends communication
-                                if( rsp.getPDUValueSize() > rspMaxSize ) {
-                                    rsp.pdu.resize(gh.getUsedMTU()); // requires another READ_BLOB_REQ
-                                }
-                                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                                return gh.send(rsp);
-                            }
-                            for(DBGattDescRef& d : c->getDescriptors()) {
-                                if( handle == d->getHandle() ) {
-                                    if( isBlobReq ) {
+                    if( value_offset > ( nullptr != value ? *value : c->getValue() ).size() ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                }
+                {
+                    bool allowed = true;
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->readCharValue(device, s, c) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: READ: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    c->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                    if( !allowed ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::NO_READ_PERM, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.2: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                }
+                value = getReadValue(c); // listener may have published a new value
+                if( nullptr != value ) {
+                    if( value_offset > value->size() ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                    return sendReadRsp(pdu, isBlobReq, value, value_offset); // Blob: value_size == value_offset -> OK, ends communication
+                }
+                if( value_offset > c->getValue().size() ) { // listener may have changed the value
+                    AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                    return gh.send(err);
+                }
+                AttReadNRsp rsp(isBlobReq, c->getValue(), value_offset); // Blob: value_size == value_offset -> OK, ends communication
+                if( rsp.getPDUValueSize() > rspMaxSize ) {
+                    rsp.pdu.resize(gh.getUsedMTU()); // requires another READ_BLOB_REQ
+                }
+                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+                return gh.send(rsp);
+            } else if( nullptr != a && DBGattServer::Attribute::Type::DESC == a->type ) {
+                const DBGattServiceRef& s = a->service;
+                const DBGattCharRef& c = a->characteristic;
+                const DBGattDescRef& d = a->descriptor;
+                if( isBlobReq ) {
 #if SEND_ATTRIBUTE_NOT_LONG
-                                        if( isBlobReq && d->getValue().size() <= rspMaxSize ) {
-                                            AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_LONG, pdu->getOpcode(), handle);
-                                            COND_PRINT(env.DEBUG_DATA, "GATT-Req: READ.0: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), toString().c_str());
-                                            gh.send(err);
-                                            return;
-                                        }
+                    if( isBlobReq && d->getValue().size() <= rspMaxSize ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_LONG, pdu->getOpcode(), handle);
+                        COND_PRINT(env.DEBUG_DATA, "GATT-Req: READ.0: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), toString().c_str());
+                        gh.send(err);
+                        return;
+                    }
 #endif
-                                        if( value_offset > c->getValue().size() ) {
-                                            AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
-                                            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                                            return gh.send(err);
-                                        }
-                                    }
-                                    {
-                                        bool allowed = true;
-                                        int i=0;
-                                        jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
-                                            try {
-                                                allowed = l->readDescValue(device, s, c, d) && allowed;
-                                            } catch (std::exception &e) {
-                                                ERR_PRINT("GATT-REQ: READ: (%s) %d/%zd: %s of %s: Caught exception %s",
-                                                        d->toString().c_str(), i+1, gattServerData->listener().size(),
-                                                        device->toString().c_str(), e.what());
-                                            }
-                                            i++;
-                                        });
-                                        if( !allowed ) {
-                                            AttErrorRsp err(AttErrorRsp::ErrorCode::NO_READ_PERM, pdu->getOpcode(), handle);
-                                            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.4: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                                            return gh.send(err);
-                                        }
-                                    }
-                                    AttReadNRsp rsp(isBlobReq, d->getValue(), value_offset); // Blob: value_size == value_offset -> OK, ends communication
-                                    if( rsp.getPDUValueSize() > rspMaxSize ) {
-                                        rsp.pdu.resize(gh.getUsedMTU()); // requires another READ_BLOB_REQ
-                                    }
-                                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.5: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                                    return gh.send(rsp);
-                                }
-                            }
-                        } // if characteristics-range
-                    } // for characteristics
-                } // if service-range
-            } // for services
+                    if( value_offset > d->getValue().size() ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                }
+                {
+                    bool allowed = true;
+                    int i=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->readDescValue(device, s, c, d) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: READ: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    d->toString().c_str(), i+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        i++;
+                    });
+                    if( !allowed ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::NO_READ_PERM, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.4: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                }
+                if( d->isClientCharConfig() && c->getValueHandle() < clientCharConfigs.size() ) {
+                    // per connection state
+                    jau::POctets cccd(2, jau::endian::little);
+                    cccd.put_uint16_nc(0, clientCharConfigs.get_uint8_nc(c->getValueHandle()));
+                    if( value_offset > cccd.size() ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                    AttReadNRsp rsp(isBlobReq, cccd, value_offset); // Blob: value_size == value_offset -> OK, ends communication
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.5: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+                    return gh.send(rsp);
+                }
+                const DBGattValueRef value = d->getValueSnapshot();
+                if( nullptr != value ) {
+                    if( value_offset > value->size() ) {
+                        AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                        return gh.send(err);
+                    }
+                    return sendReadRsp(pdu, isBlobReq, value, value_offset); // Blob: value_size == value_offset -> OK, ends communication
+                }
+                if( value_offset > d->getValue().size() ) { // listener may have changed the value
+                    AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_OFFSET, pdu->getOpcode(), handle);
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                    return gh.send(err);
+                }
+                AttReadNRsp rsp(isBlobReq, d->getValue(), value_offset); // Blob: value_size == value_offset -> OK, ends communication
+                if( rsp.getPDUValueSize() > rspMaxSize ) {
+                    rsp.pdu.resize(gh.getUsedMTU()); // requires another READ_BLOB_REQ
+                }
+                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.5: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+                return gh.send(rsp);
+            }
             AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_HANDLE, pdu->getOpcode(), handle);
             COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ.6: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
             return gh.send(err);
         }
 
+        bool replyReadMultipleReq(const AttReadMultipleReq * pdu) noexcept override {
+            // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.7 ATT_READ_MULTIPLE_REQ
+            // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.11 ATT_READ_MULTIPLE_VARIABLE_REQ
+            // BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.4 Read Multiple Characteristic Values
+            // BT Core Spec v5.2: Vol 3, Part G GATT: 4.8.5 Read Multiple Variable Length Characteristic Values
+            BTDeviceRef device = gh.getDeviceUnchecked();
+            if( nullptr == device ) {
+                AttErrorRsp err(AttErrorRsp::ErrorCode::UNLIKELY_ERROR, pdu->getOpcode(), 0);
+                ERR_PRINT("GATT-Req: READ_MULTI, null device: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                return gh.send(err);
+            }
+            if( 2 > pdu->getHandleCount() || 0 != pdu->getPDUParamSize() % 2 ) {
+                AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_PDU, pdu->getOpcode(), 0);
+                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ_MULTI.0: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                return gh.send(err);
+            }
+            // All handles are validated, values are added until the response is full, i.e. truncated at ATT_MTU-1
+            AttReadMultipleRsp rsp(pdu->isVariable(), gh.getUsedMTU());
+            bool rspFull = false;
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            for(jau::nsize_t i=0; i<pdu->getHandleCount(); ++i) {
+                const uint16_t handle = pdu->getHandle(i);
+                const DBGattServer::Attribute* a = 0 != handle ? DBGattServer::findAttribute(*table, handle) : nullptr;
+                bool allowed = true;
+                if( nullptr != a && DBGattServer::Attribute::Type::CHAR_VALUE == a->type ) {
+                    const DBGattServiceRef& s = a->service;
+                    const DBGattCharRef& c = a->characteristic;
+                    int j=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->readCharValue(device, s, c) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: READ_MULTI: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    c->toString().c_str(), j+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        j++;
+                    });
+                    if( allowed && !rspFull ) {
+                        const DBGattValueRef value = getReadValue(c); // listener may have published a new value
+                        rspFull = !rsp.addValue( nullptr != value ? *value : c->getValue() );
+                    }
+                } else if( nullptr != a && DBGattServer::Attribute::Type::DESC == a->type ) {
+                    const DBGattServiceRef& s = a->service;
+                    const DBGattCharRef& c = a->characteristic;
+                    const DBGattDescRef& d = a->descriptor;
+                    int j=0;
+                    jau::for_each_fidelity(gattServerData->listener(), [&](DBGattServer::ListenerRef &l) {
+                        try {
+                            allowed = l->readDescValue(device, s, c, d) && allowed;
+                        } catch (std::exception &e) {
+                            ERR_PRINT("GATT-REQ: READ_MULTI: (%s) %d/%zd: %s of %s: Caught exception %s",
+                                    d->toString().c_str(), j+1, gattServerData->listener().size(),
+                                    device->toString().c_str(), e.what());
+                        }
+                        j++;
+                    });
+                    if( allowed && !rspFull ) {
+                        if( d->isClientCharConfig() && c->getValueHandle() < clientCharConfigs.size() ) {
+                            // per connection state
+                            jau::POctets cccd(2, jau::endian::little);
+                            cccd.put_uint16_nc(0, clientCharConfigs.get_uint8_nc(c->getValueHandle()));
+                            rspFull = !rsp.addValue(cccd);
+                        } else {
+                            const DBGattValueRef value = d->getValueSnapshot();
+                            rspFull = !rsp.addValue( nullptr != value ? *value : d->getValue() );
+                        }
+                    }
+                } else {
+                    AttErrorRsp err(AttErrorRsp::ErrorCode::INVALID_HANDLE, pdu->getOpcode(), handle);
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ_MULTI.1: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                    return gh.send(err);
+                }
+                if( !allowed ) {
+                    AttErrorRsp err(AttErrorRsp::ErrorCode::NO_READ_PERM, pdu->getOpcode(), handle);
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ_MULTI.2: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
+                    return gh.send(err);
+                }
+            }
+            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: READ_MULTI.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+            return gh.send(rsp);
+        }
+
         bool replyFindInfoReq(const AttFindInfoReq * pdu) noexcept override {
             // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.3.1 ATT_FIND_INFORMATION_REQ
             // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.3.2 ATT_FIND_INFORMATION_RSP
@@ -649,43 +876,51 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
             const uint16_t start_handle = pdu->getStartHandle();
 
             const jau::nsize_t rspMaxSize = std::min<jau::nsize_t>(255, gh.getUsedMTU()-2);
+
+            const uint64_t cacheKey = DBGattServer::getResponseCacheKey(pdu->getOpcode(), start_handle, end_handle, 0, rspMaxSize);
+            {
+                std::shared_ptr<const AttPDUMsg> cached = gattServerData->getCachedResponse(cacheKey);
+                if( nullptr != cached ) {
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO.C: %s -> %s from %s", pdu->toString().c_str(), cached->toString().c_str(), gh.toString().c_str());
+                    return gh.send(*cached);
+                }
+            }
             AttFindInfoRsp rsp(gh.getUsedMTU()); // maximum size
             jau::nsize_t rspElemSize = 0;
             jau::nsize_t rspSize = 0;
             jau::nsize_t rspCount = 0;
 
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                for(DBGattCharRef& c : s->getCharacteristics()) {
-                    for(DBGattDescRef& d : c->getDescriptors()) {
-                        if( start_handle <= d->getHandle() && d->getHandle() <= end_handle ) {
-                            const jau::nsize_t size = 2 + d->getType()->getTypeSizeInt();
-                            if( 0 == rspElemSize ) {
-                                // initial setting or reset
-                                rspElemSize = size;
-                                rsp.setElementSize(rspElemSize);
-                            }
-                            if( rspSize + size > rspMaxSize || rspElemSize != size ) {
-                                // send if rsp is full - or - element size changed
-                                rsp.setElementCount(rspCount);
-                                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO.2: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                                return gh.send(rsp); // Client shall issue additional FIND_INFORMATION_REQ
-                            }
-                            rsp.setElementHandle(rspCount, d->getHandle());
-                            rsp.setElementValueUUID(rspCount, *d->getType());
-                            rspSize += size;
-                            ++rspCount;
-                        }
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            for(int h = start_handle; h <= std::min<int>(end_handle, DBGattServer::getAttributeEndHandle(*table)); ++h) {
+                const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, static_cast<uint16_t>(h));
+                if( nullptr != a && DBGattServer::Attribute::Type::DESC == a->type ) {
+                    const DBGattDescRef& d = a->descriptor;
+                    const jau::nsize_t size = 2 + d->getType()->getTypeSizeInt();
+                    if( 0 == rspElemSize ) {
+                        // initial setting or reset
+                        rspElemSize = size;
+                        rsp.setElementSize(rspElemSize);
+                    }
+                    if( rspSize + size > rspMaxSize || rspElemSize != size ) {
+                        // send if rsp is full - or - element size changed
+                        rsp.setElementCount(rspCount);
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO.2: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+                        return sendAndCache(cacheKey, rsp); // Client shall issue additional FIND_INFORMATION_REQ
                     }
+                    rsp.setElementHandle(rspCount, d->getHandle());
+                    rsp.setElementValueUUID(rspCount, *d->getType());
+                    rspSize += size;
+                    ++rspCount;
                 }
             }
             if( 0 < rspCount ) { // loop completed, elements added and all fitting in ATT_MTU
                 rsp.setElementCount(rspCount);
                 COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                return gh.send(rsp);
+                return sendAndCache(cacheKey, rsp);
             }
             AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_FOUND, pdu->getOpcode(), start_handle);
             COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO.4: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-            return gh.send(err);
+            return sendAndCache(cacheKey, err);
         }
 
         bool replyFindByTypeValueReq(const AttFindByTypeValueReq * pdu) noexcept override {
@@ -727,8 +962,11 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
 
             const jau::nsize_t size = 2 + 2;
 
-            for(DBGattServiceRef& s : gattServerData->getServices()) {
-                if( start_handle <= s->getHandle() && s->getHandle() <= end_handle ) {
+            const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+            for(int h = start_handle; h <= std::min<int>(end_handle, DBGattServer::getAttributeEndHandle(*table)); ++h) {
+                const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, static_cast<uint16_t>(h));
+                if( nullptr != a && DBGattServer::Attribute::Type::SERVICE == a->type ) {
+                    const DBGattServiceRef& s = a->service;
                     if( ( ( GattAttributeType::PRIMARY_SERVICE   == req_group_type &&  s->isPrimary() ) ||
                           ( GattAttributeType::SECONDARY_SERVICE == req_group_type && !s->isPrimary() )
                         ) &&
@@ -783,48 +1021,58 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
                 const uint16_t start_handle = pdu->getStartHandle();
 
                 const jau::nsize_t rspMaxSize = std::min<jau::nsize_t>(255, gh.getUsedMTU()-2);
+
+                const uint64_t cacheKey = DBGattServer::getResponseCacheKey(pdu->getOpcode(), start_handle, end_handle, req_type, rspMaxSize);
+                {
+                    std::shared_ptr<const AttPDUMsg> cached = gattServerData->getCachedResponse(cacheKey);
+                    if( nullptr != cached ) {
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE.C: %s -> %s from %s", pdu->toString().c_str(), cached->toString().c_str(), gh.toString().c_str());
+                        return gh.send(*cached);
+                    }
+                }
                 AttReadByTypeRsp rsp(gh.getUsedMTU()); // maximum size
                 jau::nsize_t rspElemSize = 0;
                 jau::nsize_t rspSize = 0;
                 jau::nsize_t rspCount = 0;
 
-                for(DBGattServiceRef& s : gattServerData->getServices()) {
-                    for(DBGattCharRef& c : s->getCharacteristics()) {
-                        if( start_handle <= c->getHandle() && c->getHandle() <= end_handle ) {
-                            const jau::nsize_t size = 2 + 1 + 2 + c->getValueType()->getTypeSizeInt();
-                            if( 0 == rspElemSize ) {
-                                // initial setting or reset
-                                rspElemSize = size;
-                                rsp.setElementSize(rspElemSize);
-                            }
-                            if( rspSize + size > rspMaxSize || rspElemSize != size ) {
-                                // send if rsp is full - or - element size changed
-                                rsp.setElementCount(rspCount);
-                                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE.2: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                                return gh.send(rsp); // Client shall issue additional READ_BY_TYPE_REQ
-                            }
-                            jau::nsize_t ePDUOffset = rsp.getElementPDUOffset(rspCount);
-                            rsp.setElementHandle(rspCount, c->getHandle()); // Characteristic Handle
-                            ePDUOffset += 2;
-                            rsp.pdu.put_uint8_nc(ePDUOffset, c->getProperties()); // Characteristics Property
-                            ePDUOffset += 1;
-                            rsp.pdu.put_uint16_nc(ePDUOffset, c->getValueHandle()); // Characteristics Value Handle
-                            ePDUOffset += 2;
-                            c->getValueType()->put(rsp.pdu.get_wptr_nc(ePDUOffset), 0, true /* littleEndian */); // Characteristics Value Type UUID
-                            ePDUOffset += c->getValueType()->getTypeSizeInt();
-                            rspSize += size;
-                            ++rspCount;
+                const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+                for(int h = start_handle; h <= std::min<int>(end_handle, DBGattServer::getAttributeEndHandle(*table)); ++h) {
+                    const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, static_cast<uint16_t>(h));
+                    if( nullptr != a && DBGattServer::Attribute::Type::CHAR_DECL == a->type ) {
+                        const DBGattCharRef& c = a->characteristic;
+                        const jau::nsize_t size = 2 + 1 + 2 + c->getValueType()->getTypeSizeInt();
+                        if( 0 == rspElemSize ) {
+                            // initial setting or reset
+                            rspElemSize = size;
+                            rsp.setElementSize(rspElemSize);
                         }
+                        if( rspSize + size > rspMaxSize || rspElemSize != size ) {
+                            // send if rsp is full - or - element size changed
+                            rsp.setElementCount(rspCount);
+                            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE.2: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
+                            return sendAndCache(cacheKey, rsp); // Client shall issue additional READ_BY_TYPE_REQ
+                        }
+                        jau::nsize_t ePDUOffset = rsp.getElementPDUOffset(rspCount);
+                        rsp.setElementHandle(rspCount, c->getHandle()); // Characteristic Handle
+                        ePDUOffset += 2;
+                        rsp.pdu.put_uint8_nc(ePDUOffset, c->getProperties()); // Characteristics Property
+                        ePDUOffset += 1;
+                        rsp.pdu.put_uint16_nc(ePDUOffset, c->getValueHandle()); // Characteristics Value Handle
+                        ePDUOffset += 2;
+                        c->getValueType()->put(rsp.pdu.get_wptr_nc(ePDUOffset), 0, true /* littleEndian */); // Characteristics Value Type UUID
+                        ePDUOffset += c->getValueType()->getTypeSizeInt();
+                        rspSize += size;
+                        ++rspCount;
                     }
                 }
                 if( 0 < rspCount ) { // loop completed, elements added and all fitting in ATT_MTU
                     rsp.setElementCount(rspCount);
                     COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                    return gh.send(rsp);
+                    return sendAndCache(cacheKey, rsp);
                 }
                 AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_FOUND, pdu->getOpcode(), pdu->getStartHandle());
                 COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE.4: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                return gh.send(err);
+                return sendAndCache(cacheKey, err);
             } else if( GattAttributeType::INCLUDE_DECLARATION == req_type ) {
                 // TODO: Support INCLUDE_DECLARATION ??
                 AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_FOUND, pdu->getOpcode(), pdu->getStartHandle());
@@ -868,16 +1116,29 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
                 const uint16_t start_handle = pdu->getStartHandle();
 
                 const jau::nsize_t rspMaxSize = std::min<jau::nsize_t>(255, gh.getUsedMTU()-2);
+
+                const uint64_t cacheKey = DBGattServer::getResponseCacheKey(pdu->getOpcode(), start_handle, end_handle, req_group_type, rspMaxSize);
+                {
+                    std::shared_ptr<const AttPDUMsg> cached = gattServerData->getCachedResponse(cacheKey);
+                    if( nullptr != cached ) {
+                        COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: GROUP_TYPE.C: %s -> %s from %s", pdu->toString().c_str(), cached->toString().c_str(), gh.toString().c_str());
+                        return gh.send(*cached);
+                    }
+                }
                 AttReadByGroupTypeRsp rsp(gh.getUsedMTU()); // maximum size
                 jau::nsize_t rspElemSize = 0;
                 jau::nsize_t rspSize = 0;
                 jau::nsize_t rspCount = 0;
 
-                for(DBGattServiceRef& s : gattServerData->getServices()) {
-                    if( ( ( GattAttributeType::PRIMARY_SERVICE   == req_group_type &&  s->isPrimary() ) ||
-                          ( GattAttributeType::SECONDARY_SERVICE == req_group_type && !s->isPrimary() )
-                        ) &&
-                        start_handle <= s->getHandle() && s->getHandle() <= end_handle )
+                const DBGattServer::AttributeTableRef table = gattServerData->getAttributeTable();
+                for(int h = start_handle; h <= std::min<int>(end_handle, DBGattServer::getAttributeEndHandle(*table)); ++h) {
+                    const DBGattServer::Attribute* a = DBGattServer::findAttribute(*table, static_cast<uint16_t>(h));
+                    if( nullptr == a || DBGattServer::Attribute::Type::SERVICE != a->type ) {
+                        continue;
+                    }
+                    const DBGattServiceRef& s = a->service;
+                    if( ( GattAttributeType::PRIMARY_SERVICE   == req_group_type &&  s->isPrimary() ) ||
+                        ( GattAttributeType::SECONDARY_SERVICE == req_group_type && !s->isPrimary() ) )
                     {
                         const jau::nsize_t size = 2 + 2 + s->getType()->getTypeSizeInt();
                         if( 0 == rspElemSize ) {
@@ -893,7 +1154,7 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
                              */
                             rsp.setElementCount(rspCount);
                             COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: GROUP_TYPE.3: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                            return gh.send(rsp); // Client shall issue additional READ_BY_TYPE_REQ
+                            return sendAndCache(cacheKey, rsp); // Client shall issue additional READ_BY_TYPE_REQ
                         }
                         rsp.setElementStartHandle(rspCount, s->getHandle());
                         rsp.setElementEndHandle(rspCount, s->getEndHandle());
@@ -905,11 +1166,11 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
                 if( 0 < rspCount ) { // loop completed, elements added and all fitting in ATT_MTU
                     rsp.setElementCount(rspCount);
                     COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: GROUP_TYPE.4: %s -> %s from %s", pdu->toString().c_str(), rsp.toString().c_str(), gh.toString().c_str());
-                    return gh.send(rsp);
+                    return sendAndCache(cacheKey, rsp);
                 }
                 AttErrorRsp err(AttErrorRsp::ErrorCode::ATTRIBUTE_NOT_FOUND, pdu->getOpcode(), pdu->getStartHandle());
                 COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: GROUP_TYPE.5: %s -> %s from %s", pdu->toString().c_str(), err.toString().c_str(), gh.toString().c_str());
-                return gh.send(err);
+                return sendAndCache(cacheKey, err);
             } else {
                 // TODO: Add other group types ???
                 AttErrorRsp err(AttErrorRsp::ErrorCode::UNSUPPORTED_GROUP_TYPE, pdu->getOpcode(), pdu->getStartHandle());
@@ -921,26 +1182,240 @@ class DBGattServerHandler : public BTGattHandler::GattServerHandler {
 
 class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
     private:
+        /**
+         * Streams notifications and indications of the forward server directly to the client in pipelined mode,
+         * invoked on the forward server's reader thread.
+         */
+        class NativeFwdCharListener : public BTGattHandler::NativeGattCharListener {
+            private:
+                std::weak_ptr<BTDevice> client;
+
+            public:
+                NativeFwdCharListener(const BTDeviceRef& client_) noexcept
+                : client(client_) {}
+
+                void notificationReceived(BTDeviceRef source, const uint16_t charHandle,
+                                          const jau::TROOctets& charValue, const uint64_t timestamp) override {
+                    (void)source;
+                    (void)timestamp;
+                    BTDeviceRef device = client.lock();
+                    std::shared_ptr<BTGattHandler> gh = nullptr != device ? device->getGattHandler() : nullptr;
+                    if( nullptr != gh && 0 != ( gh->getClientCharConfig(charHandle) & 0b001 ) ) { // client enabled notifications
+                        gh->sendNotificationAsync(charHandle, charValue); // don't stall the forward server's reader thread
+                    }
+                }
+
+                void indicationReceived(BTDeviceRef source, const uint16_t charHandle,
+                                        const jau::TROOctets& charValue, const uint64_t timestamp,
+                                        const bool confirmationSent) override {
+                    (void)source;
+                    (void)timestamp;
+                    (void)confirmationSent;
+                    BTDeviceRef device = client.lock();
+                    std::shared_ptr<BTGattHandler> gh = nullptr != device ? device->getGattHandler() : nullptr;
+                    if( nullptr != gh && 0 != ( gh->getClientCharConfig(charHandle) & 0b010 ) ) { // client enabled indications
+                        gh->sendIndicationAsync(charHandle, charValue);
+                    }
+                }
+
+                std::string toString() override {
+                    return "NativeFwdCharListener[this "+jau::to_hexstring(this)+"]";
+                }
+        };
+
         BTGattHandler& gh;
+        DBGattServerRef gattServerData;
         BTDeviceRef fwdServer;
         std::shared_ptr<BTGattHandler> fwd_gh;
+        const bool pipelined;
 
         jau::darray<AttPrepWrite> writeDataQueue;
         jau::darray<uint16_t> writeDataQueueHandles;
 
+        std::shared_ptr<NativeFwdCharListener> fwdCharListener;
+
+        /** Client Characteristic Configuration bits written by this connection's client, keyed by characteristic value handle. */
+        std::mutex mtx_clientCharConfigs;
+        std::unordered_map<uint16_t, uint8_t> clientCharConfigs;
+
+        /** Pipelined mode: write commands to be forwarded by writeCmdThread. */
+        std::mutex mtx_writeCmd;
+        std::condition_variable cv_writeCmd;
+        jau::darray<std::unique_ptr<const AttPDUMsg>> writeCmdQueue;
+        std::thread writeCmdThread;
+        bool writeCmdRunning;
+        /** Pipelined mode: writeCmdThread is sending a dequeued write command. */
+        bool writeCmdSending;
+
+        void writeCmdWork() noexcept {
+            std::unique_lock<std::mutex> lock(mtx_writeCmd); // RAII-style acquire and relinquish via destructor
+            while( writeCmdRunning ) {
+                if( writeCmdQueue.size() == 0 ) {
+                    cv_writeCmd.wait(lock);
+                    continue;
+                }
+                std::unique_ptr<const AttPDUMsg> pdu = std::move( writeCmdQueue[0] );
+                writeCmdQueue.erase(writeCmdQueue.begin());
+                writeCmdSending = true;
+                cv_writeCmd.notify_all(); // space available
+                lock.unlock();
+                const bool res = fwd_gh->send(*pdu); // may block on the forward server's L2CAP send queue
+                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: WRITE.21.Q: res %d, %s to %s", res, pdu->toString().c_str(), fwd_gh->toString().c_str());
+                lock.lock();
+                writeCmdSending = false;
+                cv_writeCmd.notify_all(); // maybe drained, see drainWriteCmds()
+            }
+        }
+
+        /**
+         * Pipelined mode: Blocks until all queued write commands have been sent to the forward server,
+         * preserving the client's ATT PDU order ahead of a synchronously forwarded request.
+         */
+        void drainWriteCmds() noexcept {
+            std::unique_lock<std::mutex> lock(mtx_writeCmd); // RAII-style acquire and relinquish via destructor
+            while( writeCmdRunning && ( writeCmdQueue.size() > 0 || writeCmdSending ) ) {
+                cv_writeCmd.wait(lock);
+            }
+        }
+
+        /** Forwards the given request to the forward server after all queued write commands and returns its reply. */
+        std::unique_ptr<const AttPDUMsg> forwardWithReply(const AttPDUMsg & pdu, const jau::fraction_i64& timeout) noexcept {
+            drainWriteCmds();
+            return fwd_gh->sendWithReply(pdu, timeout);
+        }
+
+        /** Returns the characteristic value handle if the given handle is a forward server's Client Characteristic Configuration descriptor, otherwise zero. */
+        uint16_t findClientCharConfigValueHandle(const uint16_t handle) noexcept {
+            for(BTGattServiceRef& s : fwd_gh->getServices()) {
+                if( handle <= s->handle || handle > s->end_handle ) {
+                    continue;
+                }
+                const jau::nsize_t charCount = s->characteristicList.size();
+                for(jau::nsize_t i=0; i < charCount; ++i) {
+                    BTGattCharRef& c = s->characteristicList[i];
+                    const uint16_t char_end = i+1 < charCount ? s->characteristicList[i+1]->handle - 1 : s->end_handle;
+                    if( handle > c->value_handle && handle <= char_end ) {
+                        BTGattDescRef cccd = c->getClientCharConfig(); // may discover descriptors on demand
+                        return nullptr != cccd && handle == cccd->handle ? c->value_handle : 0;
+                    }
+                }
+            }
+            return 0;
+        }
+
+        /** Tracks the client's successfully written Client Characteristic Configuration, see getClientCharConfig(). */
+        void updateClientCharConfig(const AttWriteReq & req) noexcept {
+            const jau::TOctetSlice &value = req.getValue();
+            if( 0 == value.size() ) {
+                return;
+            }
+            const uint16_t value_handle = findClientCharConfigValueHandle(req.getHandle());
+            if( 0 != value_handle ) {
+                const uint8_t v = *value.get_ptr_nc(0) & 0b011;
+                const std::lock_guard<std::mutex> lock(mtx_clientCharConfigs); // RAII-style acquire and relinquish via destructor
+                clientCharConfigs[value_handle] = v;
+                COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: WRITE CCCD: char value handle %s -> %u", jau::to_hexstring(value_handle).c_str(), v);
+            }
+        }
+
+        /** Pipelined mode: Queues the given write command, blocks while the queue is full. */
+        bool queueWriteCmd(const AttPDUMsg * pdu) noexcept {
+            std::unique_ptr<const AttPDUMsg> copy = std::make_unique<AttPDUMsg>(pdu->pdu.get_ptr(), pdu->pdu.size());
+            std::unique_lock<std::mutex> lock(mtx_writeCmd); // RAII-style acquire and relinquish via destructor
+            while( writeCmdRunning && writeCmdQueue.size() >= static_cast<jau::nsize_t>(gh.env.GATT_FWD_WRITE_CMD_QUEUE_CAPACITY) ) {
+                cv_writeCmd.wait(lock);
+            }
+            if( !writeCmdRunning ) {
+                return false;
+            }
+            writeCmdQueue.push_back( std::move( copy ) );
+            cv_writeCmd.notify_all();
+            return true;
+        }
+
+        /**
+         * Pipelined mode: Returns the cache key of the given immutable discovery request or zero if not cacheable.
+         */
+        uint64_t getDiscoveryCacheKey(const AttPDUMsg * pdu, const uint16_t start_handle, const uint16_t end_handle, const uint16_t type) noexcept {
+            if( !pipelined ) {
+                return 0;
+            }
+            // the forwarded response is limited by both links
+            const jau::nsize_t rspMaxSize = std::min<jau::nsize_t>(255, std::min(gh.getUsedMTU(), fwd_gh->getUsedMTU())-2);
+            return DBGattServer::getResponseCacheKey(pdu->getOpcode(), start_handle, end_handle, type, rspMaxSize);
+        }
+
+        /**
+         * Forwards the given request and replies the forward server's response to the client,
+         * using and populating the discovery response cache if the given `cacheKey` is not zero.
+         */
+        bool forwardDiscoveryReq(const AttPDUMsg * pdu, const uint64_t cacheKey, const char* tag) noexcept {
+            if( 0 != cacheKey ) {
+                std::shared_ptr<const AttPDUMsg> cached = gattServerData->getCachedResponse(cacheKey);
+                if( nullptr != cached ) {
+                    COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: %s.C: %s -> %s from cache", tag, pdu->toString().c_str(), cached->toString().c_str());
+                    return gh.send(*cached);
+                }
+            }
+            BTDeviceRef clientSource = gh.getDeviceUnchecked();
+            fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
+            std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
+            if( nullptr == rsp ) {
+                ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
+                return false;
+            }
+            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: %s: %s -> %s from %s", tag, pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
+            fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
+            if( 0 != cacheKey ) {
+                gattServerData->putCachedResponse(cacheKey, *rsp);
+            }
+            return gh.send(*rsp);
+        }
+
     public:
-        FwdGattServerHandler(BTGattHandler& gh_, BTDeviceRef fwdServer_) noexcept
-        : gh(gh_), fwdServer(fwdServer_) {
+        FwdGattServerHandler(BTGattHandler& gh_, DBGattServerRef gattServerData_, BTDeviceRef fwdServer_) noexcept
+        : gh(gh_), gattServerData(gattServerData_), fwdServer(fwdServer_),
+          pipelined(gattServerData->isFwdPipelined()),
+          fwdCharListener(nullptr), writeCmdRunning(false), writeCmdSending(false)
+        {
             fwd_gh = fwdServer->getGattHandler();
+            if( pipelined && nullptr != fwd_gh ) {
+                gattServerData->setCachedResponsesSource(fwd_gh);
+                fwdCharListener = std::make_shared<NativeFwdCharListener>(gh.getDeviceUnchecked());
+                fwd_gh->addCharListener(fwdCharListener);
+                writeCmdRunning = true;
+                writeCmdThread = std::thread(&FwdGattServerHandler::writeCmdWork, this); // @suppress("Invalid arguments")
+            }
         }
 
+        ~FwdGattServerHandler() noexcept override { close(); }
+
         void close() noexcept override {
             writeDataQueue.clear();
             writeDataQueueHandles.clear();
+            if( nullptr != fwdCharListener ) {
+                fwd_gh->removeCharListener(fwdCharListener);
+                fwdCharListener = nullptr;
+            }
+            {
+                const std::lock_guard<std::mutex> lock(mtx_writeCmd); // RAII-style acquire and relinquish via destructor
+                writeCmdRunning = false;
+                writeCmdQueue.clear();
+                cv_writeCmd.notify_all();
+            }
+            if( writeCmdThread.joinable() ) {
+                writeCmdThread.join();
+            }
         }
 
         DBGattServer::Mode getMode() noexcept override { return DBGattServer::Mode::FWD; }
 
+        uint8_t getClientCharConfig(const uint16_t char_value_handle) noexcept override {
+            const std::lock_guard<std::mutex> lock(mtx_clientCharConfigs); // RAII-style acquire and relinquish via destructor
+            auto it = clientCharConfigs.find(char_value_handle);
+            return clientCharConfigs.end() != it ? it->second : 0;
+        }
+
         bool replyExchangeMTUReq(const AttExchangeMTU * pdu) noexcept override {
             if( !fwd_gh->isConnected() ) {
                 close();
@@ -949,7 +1424,7 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
             BTDeviceRef clientSource = gh.getDeviceUnchecked();
             fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
             const uint16_t clientMTU = pdu->getMTUSize();
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
+            std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
             if( nullptr == rsp ) {
                 ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
                 return false;
@@ -991,7 +1466,7 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                         writeDataQueueHandles.push_back(handle);
                     }
                 }
-                std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
+                std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
                 if( nullptr == rsp ) {
                     ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
                     return false;
@@ -1049,7 +1524,7 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                     writeDataQueue.clear();
                     writeDataQueueHandles.clear();
                 }
-                std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
+                std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
                 if( nullptr == rsp ) {
                     ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
                     return false;
@@ -1073,13 +1548,16 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                     sections.emplace_back( 0, (uint16_t)p_value.size() );
                     fwd_gh->notifyNativeWriteRequest(p.getHandle(), p_val, sections, true /* with_response */, clientSource);
                 }
-                std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
+                std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.write_cmd_reply_timeout); // valid reply or exception
                 if( nullptr == rsp ) {
                     ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
                     return false;
                 }
                 COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: WRITE.22: %s -> %s from %s", pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
                 fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
+                if( AttPDUMsg::Opcode::WRITE_RSP == rsp->getOpcode() ) {
+                    updateClientCharConfig(*static_cast<const AttWriteReq*>(pdu));
+                }
                 {
                     const AttErrorRsp::ErrorCode error_code = AttPDUMsg::Opcode::ERROR_RSP == rsp->getOpcode() ?
                             static_cast<const AttErrorRsp*>(rsp.get())->getErrorCode() : AttErrorRsp::ErrorCode::NO_ERROR;
@@ -1095,6 +1573,10 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                     sections.emplace_back( 0, (uint16_t)p_value.size() );
                     fwd_gh->notifyNativeWriteRequest(p.getHandle(), p_val, sections, false /* with_response */, clientSource);
                 }
+                if( pipelined ) {
+                    // no reply expected, forwarded asynchronously
+                    return queueWriteCmd(pdu);
+                }
                 const bool res = fwd_gh->send(*pdu);
                 COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: WRITE.21: res %d, %s to %s", res, pdu->toString().c_str(), fwd_gh->toString().c_str());
                 return res;
@@ -1142,7 +1624,7 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                     value_offset = 0;
                 }
             }
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
+            std::unique_ptr<const AttPDUMsg> rsp = forwardWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
             if( nullptr == rsp ) {
                 ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
                 return false;
@@ -1171,16 +1653,7 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                 close();
                 return false;
             }
-            BTDeviceRef clientSource = gh.getDeviceUnchecked();
-            fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
-            if( nullptr == rsp ) {
-                ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
-                return false;
-            }
-            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: INFO: %s -> %s from %s", pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
-            fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
-            return gh.send(*rsp);
+            return forwardDiscoveryReq(pdu, getDiscoveryCacheKey(pdu, pdu->getStartHandle(), pdu->getEndHandle(), 0), "INFO");
         }
 
         bool replyFindByTypeValueReq(const AttFindByTypeValueReq * pdu) noexcept override {
@@ -1188,16 +1661,17 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                 close();
                 return false;
             }
-            BTDeviceRef clientSource = gh.getDeviceUnchecked();
-            fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
-            if( nullptr == rsp ) {
-                ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
+            return forwardDiscoveryReq(pdu, 0 /* value dependent, not cached */, "TYPEVALUE");
+        }
+
+        bool replyReadMultipleReq(const AttReadMultipleReq * pdu) noexcept override {
+            // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.7 ATT_READ_MULTIPLE_REQ
+            // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.11 ATT_READ_MULTIPLE_VARIABLE_REQ
+            if( !fwd_gh->isConnected() ) {
+                close();
                 return false;
             }
-            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPEVALUE: %s -> %s from %s", pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
-            fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
-            return gh.send(*rsp);
+            return forwardDiscoveryReq(pdu, 0 /* value dependent, not cached */, "READ_MULTI");
         }
 
         bool replyReadByTypeReq(const AttReadByNTypeReq * pdu) noexcept override {
@@ -1205,16 +1679,14 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                 close();
                 return false;
             }
-            BTDeviceRef clientSource = gh.getDeviceUnchecked();
-            fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
-            if( nullptr == rsp ) {
-                ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
-                return false;
+            uint16_t req_type = 0; // not cached
+            if( pdu->getNType()->equivalent( jau::uuid16_t(GattAttributeType::CHARACTERISTIC) ) ) {
+                req_type = GattAttributeType::CHARACTERISTIC;
+            } else if( pdu->getNType()->equivalent( jau::uuid16_t(GattAttributeType::INCLUDE_DECLARATION) ) ) {
+                req_type = GattAttributeType::INCLUDE_DECLARATION;
             }
-            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: TYPE: %s -> %s from %s", pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
-            fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
-            return gh.send(*rsp);
+            const uint64_t cacheKey = 0 != req_type ? getDiscoveryCacheKey(pdu, pdu->getStartHandle(), pdu->getEndHandle(), req_type) : 0;
+            return forwardDiscoveryReq(pdu, cacheKey, "TYPE");
         }
 
         bool replyReadByGroupTypeReq(const AttReadByNTypeReq * pdu) noexcept override {
@@ -1222,16 +1694,14 @@ class FwdGattServerHandler : public BTGattHandler::GattServerHandler {
                 close();
                 return false;
             }
-            BTDeviceRef clientSource = gh.getDeviceUnchecked();
-            fwd_gh->notifyNativeRequestSent(*pdu, clientSource);
-            std::unique_ptr<const AttPDUMsg> rsp = fwd_gh->sendWithReply(*pdu, gh.read_cmd_reply_timeout); // valid reply or exception
-            if( nullptr == rsp ) {
-                ERR_PRINT2("No reply; req %s from %s", pdu->toString().c_str(), fwd_gh->toString().c_str());
-                return false;
+            uint16_t req_group_type = 0; // not cached
+            if( pdu->getNType()->equivalent( jau::uuid16_t(GattAttributeType::PRIMARY_SERVICE) ) ) {
+                req_group_type = GattAttributeType::PRIMARY_SERVICE;
+            } else if( pdu->getNType()->equivalent( jau::uuid16_t(GattAttributeType::SECONDARY_SERVICE) ) ) {
+                req_group_type = GattAttributeType::SECONDARY_SERVICE;
             }
-            COND_PRINT(gh.env.DEBUG_DATA, "GATT-Req: GROUP_TYPE: %s -> %s from %s", pdu->toString().c_str(), rsp->toString().c_str(), fwd_gh->toString().c_str());
-            fwd_gh->notifyNativeReplyReceived(*rsp, clientSource);
-            return gh.send(*rsp);
+            const uint64_t cacheKey = 0 != req_group_type ? getDiscoveryCacheKey(pdu, pdu->getStartHandle(), pdu->getEndHandle(), req_group_type) : 0;
+            return forwardDiscoveryReq(pdu, cacheKey, "GROUP_TYPE");
         }
 };
 
@@ -1247,7 +1717,7 @@ std::unique_ptr<BTGattHandler::GattServerHandler> BTGattHandler::selectGattServe
             case DBGattServer::Mode::FWD: {
                 BTDeviceRef fwdServer = gattServerData->getFwdServer();
                 if( nullptr != fwdServer ) {
-                    return std::make_unique<FwdGattServerHandler>(gh, fwdServer);
+                    return std::make_unique<FwdGattServerHandler>(gh, gattServerData, fwdServer);
                 }
                 [[fallthrough]];
             }
@@ -62,7 +62,7 @@ using namespace jau::fractions_i64_literals;
 MgmtEnv::MgmtEnv() noexcept
 : DEBUG_GLOBAL( jau::environment::get("direct_bt").debug ),
   exploding( jau::environment::getExplodingProperties("direct_bt.mgmt") ),
-  MGMT_READER_THREAD_POLL_TIMEOUT( jau::environment::getFractionProperty("direct_bt.mgmt.reader.timeout", 10_s, 1500_ms /* min */, 365_d /* max */) ),
+  MGMT_READER_THREAD_POLL_TIMEOUT( jau::environment::getFractionProperty("direct_bt.mgmt.reader.timeout", 0_s, 0_s /* min */, 365_d /* max */) ),
   MGMT_COMMAND_REPLY_TIMEOUT( jau::environment::getFractionProperty("direct_bt.mgmt.cmd.timeout", 3_s, 1500_ms /* min */, 365_d /* max */) ),
   MGMT_SET_POWER_COMMAND_TIMEOUT( jau::environment::getFractionProperty("direct_bt.mgmt.setpower.timeout",
                                                                   jau::max(MGMT_COMMAND_REPLY_TIMEOUT, 6_s) /* default */,
@@ -539,6 +539,8 @@ void BTManager::close() noexcept {
     adapterIOCapability.clear();
 
     PERF3_TS_TD("BTManager::close.1");
+    mgmt_reader_service.set_shall_stop();
+    comm.wakeup(); // interrupt blocking read()
     mgmt_reader_service.stop();
     comm.close();
     PERF3_TS_TD("BTManager::close.2");
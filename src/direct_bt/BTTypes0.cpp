@@ -468,6 +468,38 @@ std::string direct_bt::to_string(const L2CAP_PSM v) noexcept {
     return "Unknown L2CAP_PSM "+jau::to_hexstring(number(v));
 }
 
+std::string direct_bt::to_string(const L2CAPIOProfile v) noexcept {
+    switch(v) {
+        case L2CAPIOProfile::DEFAULT:     return "DEFAULT";
+        case L2CAPIOProfile::LOW_LATENCY: return "LOW_LATENCY";
+        case L2CAPIOProfile::BULK:        return "BULK";
+    }
+    return "Unknown L2CAPIOProfile "+jau::to_hexstring(number(v));
+}
+
+L2CAPStats& L2CAPStats::operator+=(const L2CAPStats& o) noexcept {
+    reads += o.reads;
+    bytes_read += o.bytes_read;
+    writes += o.writes;
+    bytes_written += o.bytes_written;
+    eagain_retries += o.eagain_retries;
+    poll_timeouts += o.poll_timeouts;
+    interrupts += o.interrupts;
+    read_errors += o.read_errors;
+    write_errors += o.write_errors;
+    queue_full += o.queue_full;
+    write_blocked_us += o.write_blocked_us;
+    return *this;
+}
+
+std::string L2CAPStats::toString() const noexcept {
+    return "L2CAPStats[read "+std::to_string(reads)+" / "+std::to_string(bytes_read)+" bytes"+
+           ", write "+std::to_string(writes)+" / "+std::to_string(bytes_written)+" bytes, blocked "+std::to_string(write_blocked_us)+" us"+
+           ", eagain "+std::to_string(eagain_retries)+", poll_to "+std::to_string(poll_timeouts)+
+           ", irq "+std::to_string(interrupts)+", err[read "+std::to_string(read_errors)+", write "+std::to_string(write_errors)+
+           "], queue_full "+std::to_string(queue_full)+"]";
+}
+
 #define APPEARANCECAT_ENUM(X) \
     X(UNKNOWN) \
     X(GENERIC_PHONE) \
@@ -31,10 +31,21 @@
 #include <cstdio>
 
 #include  <algorithm>
+#include <fstream>
+
+extern "C" {
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+}
 
 #include <jau/debug.hpp>
+#include <jau/file_util.hpp>
 
 #include "DBGattServer.hpp"
+#include "BTDevice.hpp"
+#include "BTGattHandler.hpp"
 
 using namespace direct_bt;
 
@@ -72,6 +83,24 @@ bool DBGattChar::setValue(const uint8_t* source, const jau::nsize_t source_len,
     return true;
 }
 
+void DBGattDesc::publishValue(const jau::TROOctets & v) noexcept {
+    try {
+        std::shared_ptr<jau::POctets> snapshot = std::make_shared<jau::POctets>(v, std::max(value.capacity(), v.size()));
+        std::atomic_store(&value_snapshot, DBGattValueRef(snapshot));
+    } catch (std::exception &e) {
+        ERR_PRINT("Caught exception %s", e.what());
+    }
+}
+
+void DBGattChar::publishValue(const jau::TROOctets & v) noexcept {
+    try {
+        std::shared_ptr<jau::POctets> snapshot = std::make_shared<jau::POctets>(v, std::max(value.capacity(), v.size()));
+        std::atomic_store(&value_snapshot, DBGattValueRef(snapshot));
+    } catch (std::exception &e) {
+        ERR_PRINT("Caught exception %s", e.what());
+    }
+}
+
 std::string direct_bt::to_string(const DBGattServer::Mode m) noexcept {
     switch(m) {
         case DBGattServer::Mode::NOP: return "nop";
@@ -100,6 +129,535 @@ bool DBGattServer::removeListener(ListenerRef l) {
     return count > 0;
 }
 
+void DBGattServer::buildAttributeTable() {
+    // Build a new table and publish it, keeping snapshots held by concurrent requests intact
+    AttributeTableRef table = std::make_shared<AttributeTable>();
+    uint16_t end_handle = 0;
+    for(DBGattServiceRef& s : services) {
+        end_handle = std::max(end_handle, s->getEndHandle());
+    }
+    if( 0 < end_handle ) {
+        table->reserve( end_handle + 1 );
+        table->push_back( Attribute() ); // handle 0 is invalid
+
+        // Same traversal order as DBGattService::setHandles(), i.e. index == handle
+        for(DBGattServiceRef& s : services) {
+            table->push_back( Attribute { Attribute::Type::SERVICE, s, nullptr, nullptr } );
+            for(DBGattCharRef& c : s->getCharacteristics()) {
+                table->push_back( Attribute { Attribute::Type::CHAR_DECL, s, c, nullptr } );
+                table->push_back( Attribute { Attribute::Type::CHAR_VALUE, s, c, nullptr } );
+                for(DBGattDescRef& d : c->getDescriptors()) {
+                    table->push_back( Attribute { Attribute::Type::DESC, s, c, d } );
+                }
+            }
+        }
+    }
+    attributes.set_store( std::move(table) );
+}
+
+static jau::cow_darray<BTDeviceRef>::equal_comparator _deviceRefEqComparator =
+        [](const BTDeviceRef &a, const BTDeviceRef &b) -> bool { return a.get() == b.get(); };
+
+bool DBGattServer::addConnectedDevice(const BTDeviceRef& device) noexcept {
+    if( nullptr == device ) {
+        return false;
+    }
+    return connectedDevices.push_back_unique(device, _deviceRefEqComparator);
+}
+
+bool DBGattServer::removeConnectedDevice(const BTDeviceRef& device) noexcept {
+    if( nullptr == device ) {
+        return false;
+    }
+    const int count = connectedDevices.erase_matching(device, false /* all_matching */, _deviceRefEqComparator);
+    return count > 0;
+}
+
+std::shared_ptr<const AttPDUMsg> DBGattServer::getCachedResponse(const uint64_t key) noexcept {
+    const std::lock_guard<std::mutex> lock(mtx_rspCache); // RAII-style acquire and relinquish via destructor
+    auto it = rspCache.find(key);
+    if( rspCache.end() == it ) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void DBGattServer::putCachedResponse(const uint64_t key, const AttPDUMsg& rsp) noexcept {
+    try {
+        std::shared_ptr<const AttPDUMsg> copy = std::make_shared<AttPDUMsg>(rsp.pdu.get_ptr(), rsp.pdu.size());
+        const std::lock_guard<std::mutex> lock(mtx_rspCache); // RAII-style acquire and relinquish via destructor
+        if( rspCache.size() >= MAX_CACHED_RESPONSES ) {
+            // bounded, e.g. against clients iterating through arbitrary ranges
+            rspCache.clear();
+        }
+        rspCache[key] = copy;
+    } catch (std::exception &e) {
+        ERR_PRINT("Caught exception %s", e.what());
+    }
+}
+
+void DBGattServer::clearCachedResponses() noexcept {
+    const std::lock_guard<std::mutex> lock(mtx_rspCache); // RAII-style acquire and relinquish via destructor
+    rspCache.clear();
+}
+
+void DBGattServer::setCachedResponsesSource(const std::shared_ptr<const void>& source) noexcept {
+    const std::lock_guard<std::mutex> lock(mtx_rspCache); // RAII-style acquire and relinquish via destructor
+    if( rspCacheSource.lock() != source ) {
+        rspCache.clear();
+        rspCacheSource = source;
+    }
+}
+
+std::string DBGattServer::NotifyAllResult::toString() const noexcept {
+    return "NotifyAll[subscribed "+std::to_string(subscribed)+", sent "+std::to_string(sent)+
+           ", failed "+std::to_string(failed.size())+", saturated "+std::to_string(saturated.size())+
+           ", pdus "+std::to_string(pdu_count)+"]";
+}
+
+DBGattServer::NotifyAllResult DBGattServer::notifyAll(const DBGattCharRef& c, const jau::TROOctets & value) noexcept {
+    NotifyAllResult res;
+    if( nullptr == c ) {
+        ERR_PRINT("Characteristic is null");
+        return res;
+    }
+    const uint16_t char_value_handle = c->getValueHandle();
+    if( c != findGattCharByValueHandle(char_value_handle) ) {
+        ERR_PRINT("Characteristic not part of this server: %s", c->toString().c_str());
+        return res;
+    }
+    if( !c->hasProperties(BTGattChar::PropertyBitVal::Notify) ) {
+        ERR_PRINT("Characteristic has no notify property: %s", c->toString().c_str());
+        return res;
+    }
+    if( 0 == value.size() ) {
+        return res;
+    }
+
+    struct Target {
+        BTDeviceRef device;
+        std::shared_ptr<BTGattHandler> gh;
+        jau::nsize_t value_size;
+    };
+    jau::darray<Target> targets;
+    jau::darray<jau::nsize_t> pdu_sizes; // one per ATT_MTU size class
+
+    // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.1 ATT_HANDLE_VALUE_NTF: opcode + handle, shared by all clients
+    uint8_t header[3];
+    header[0] = AttPDUMsg::number(AttPDUMsg::Opcode::HANDLE_VALUE_NTF);
+    jau::put_uint16(header, 1, char_value_handle, true /* littleEndian */);
+
+    // 1st pass: Determine subscribers and their ATT_MTU size class
+    jau::for_each_fidelity(connectedDevices, [&](BTDeviceRef &device) {
+        std::shared_ptr<BTGattHandler> gh = device->getGattHandler();
+        if( nullptr == gh || !gh->isConnected() ) {
+            return;
+        }
+        if( 0 == ( gh->getClientCharConfig(char_value_handle) & 0b001 ) ) {
+            return;
+        }
+        ++res.subscribed;
+        const jau::nsize_t value_size = std::min<jau::nsize_t>(gh->getUsedMTU() - 3, value.size());
+        if( pdu_sizes.cend() == std::find(pdu_sizes.cbegin(), pdu_sizes.cend(), value_size) ) {
+            pdu_sizes.push_back(value_size);
+        }
+        targets.push_back( Target { device, gh, value_size } );
+    });
+    res.pdu_count = pdu_sizes.size();
+
+    // 2nd pass: Batch write to all client sockets
+    for(Target& t : targets) {
+        const jau::snsize_t space = t.gh->getTxQueueSpace();
+        if( 0 <= space && static_cast<jau::nsize_t>(space) < sizeof(header) + t.value_size ) {
+            res.saturated.push_back(t.device);
+            continue;
+        }
+        if( t.gh->sendScattered(header, sizeof(header), value.get_ptr(), t.value_size) ) {
+            ++res.sent;
+        } else {
+            res.failed.push_back(t.device);
+        }
+    }
+    if( !res.isComplete() ) {
+        DBG_PRINT("DBGattServer::notifyAll: %s: %s", c->toString().c_str(), res.toString().c_str());
+    }
+    return res;
+}
+
+DBGattServer::NotifyAllResult DBGattServer::notifyAll(const DBGattCharRef& c) noexcept {
+    if( nullptr == c ) {
+        ERR_PRINT("Characteristic is null");
+        return NotifyAllResult();
+    }
+    const DBGattValueRef snapshot = c->getValueSnapshot(); // keeps the snapshot alive while sending
+    return notifyAll(c, nullptr != snapshot ? *snapshot : c->getValue());
+}
+
+bool DBGattServer::queueNotification(const DBGattCharRef& c, const jau::TROOctets & value) noexcept {
+    if( nullptr == c ) {
+        ERR_PRINT("Characteristic is null");
+        return false;
+    }
+    try {
+        return queueNotification(c, DBGattValueRef( std::make_shared<jau::POctets>(value, value.size()) ));
+    } catch (std::exception &e) {
+        ERR_PRINT("Caught exception %s", e.what());
+        return false;
+    }
+}
+
+bool DBGattServer::queueNotification(const DBGattCharRef& c) noexcept {
+    if( nullptr == c ) {
+        ERR_PRINT("Characteristic is null");
+        return false;
+    }
+    const DBGattValueRef snapshot = c->getValueSnapshot();
+    if( nullptr != snapshot ) {
+        return queueNotification(c, snapshot);
+    }
+    return queueNotification(c, c->getValue());
+}
+
+bool DBGattServer::queueNotification(const DBGattCharRef& c, const DBGattValueRef& value) noexcept {
+    if( c != findGattCharByValueHandle(c->getValueHandle()) ) {
+        ERR_PRINT("Characteristic not part of this server: %s", c->toString().c_str());
+        return false;
+    }
+    if( !c->hasProperties(BTGattChar::PropertyBitVal::Notify) ) {
+        ERR_PRINT("Characteristic has no notify property: %s", c->toString().c_str());
+        return false;
+    }
+    const std::lock_guard<std::mutex> lock(mtx_pendingNtf); // RAII-style acquire and relinquish via destructor
+    for(PendingNotification& p : pendingNtf) {
+        if( c == p.characteristic ) {
+            p.value = value; // latest value wins
+            return true;
+        }
+    }
+    pendingNtf.push_back( PendingNotification { c, value } );
+    return true;
+}
+
+jau::nsize_t DBGattServer::getPendingNotificationCount() noexcept {
+    const std::lock_guard<std::mutex> lock(mtx_pendingNtf); // RAII-style acquire and relinquish via destructor
+    return pendingNtf.size();
+}
+
+DBGattServer::NotifyAllResult DBGattServer::flushNotifications() noexcept {
+    NotifyAllResult res;
+    jau::darray<PendingNotification> pending;
+    {
+        const std::lock_guard<std::mutex> lock(mtx_pendingNtf); // RAII-style acquire and relinquish via destructor
+        pending.swap(pendingNtf);
+    }
+    if( 0 == pending.size() ) {
+        return res;
+    }
+    jau::darray<const PendingNotification*> batch;
+    jau::for_each_fidelity(connectedDevices, [&](BTDeviceRef &device) {
+        std::shared_ptr<BTGattHandler> gh = device->getGattHandler();
+        if( nullptr == gh || !gh->isConnected() ) {
+            return;
+        }
+        const jau::nsize_t mtu = gh->getUsedMTU();
+        const bool multi = gh->isMultipleHandleValueNtfSupported();
+        bool ok = true;
+        bool subscribed = false;
+
+        // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.7.4 ATT_MULTIPLE_HANDLE_VALUE_NTF holds two or more tuples
+        auto sendBatch = [&]() {
+            if( 1 == batch.size() ) {
+                ok = gh->sendNotification(batch[0]->characteristic->getValueHandle(), *batch[0]->value) && ok;
+                ++res.pdu_count;
+            } else if( 1 < batch.size() ) {
+                AttMultipleHandleValueNtf ntf(mtu);
+                for(const PendingNotification* p : batch) {
+                    ntf.addHandleValue(p->characteristic->getValueHandle(), *p->value);
+                }
+                ok = gh->sendMultipleNotification(ntf) && ok;
+                ++res.pdu_count;
+            }
+            batch.clear();
+        };
+        jau::nsize_t batch_size = 1; // opcode
+        for(const PendingNotification& p : pending) {
+            const uint16_t char_value_handle = p.characteristic->getValueHandle();
+            if( 0 == ( gh->getClientCharConfig(char_value_handle) & 0b001 ) || 0 == p.value->size() ) {
+                continue;
+            }
+            subscribed = true;
+            const jau::nsize_t tuple_size = 2 + 2 + p.value->size();
+            if( !multi || 1 + tuple_size > mtu ) {
+                ok = gh->sendNotification(char_value_handle, *p.value) && ok; // value truncated to ATT_MTU-3
+                ++res.pdu_count;
+                continue;
+            }
+            if( batch_size + tuple_size > mtu ) {
+                sendBatch();
+                batch_size = 1;
+            }
+            batch.push_back(&p);
+            batch_size += tuple_size;
+        }
+        sendBatch();
+        if( subscribed ) {
+            ++res.subscribed;
+            if( ok ) {
+                ++res.sent;
+            } else {
+                res.failed.push_back(device);
+            }
+        }
+    });
+    if( !res.isComplete() ) {
+        DBG_PRINT("DBGattServer::flushNotifications: %zu pending: %s", pending.size(), res.toString().c_str());
+    }
+    return res;
+}
+
+namespace {
+    /** Returns the index of the given UUID within the table, adding it if not contained. */
+    jau::nsize_t uuidIndex(jau::darray<std::shared_ptr<const jau::uuid_t>>& table, const std::shared_ptr<const jau::uuid_t>& uuid) {
+        for(jau::nsize_t i=0; i<table.size(); ++i) {
+            if( *table[i] == *uuid ) {
+                return i;
+            }
+        }
+        table.push_back(uuid);
+        return table.size()-1;
+    }
+
+    constexpr jau::nsize_t binaryValueSize(const jau::TROOctets& v) noexcept { return 2 + 2 + v.size(); }
+
+    /** Returns true if the given value and its capacity fit into the binary image's uint16_t fields. */
+    constexpr bool isBinaryValueValid(const jau::TROOctets& v, const jau::nsize_t capacity) noexcept {
+        return v.size() <= UINT16_MAX && capacity <= UINT16_MAX;
+    }
+
+    jau::nsize_t putBinaryValue(jau::POctets& img, jau::nsize_t i, const jau::TROOctets& v, const jau::nsize_t capacity) {
+        img.put_uint16(i, static_cast<uint16_t>( std::max(capacity, v.size()) )); i+=2;
+        img.put_uint16(i, static_cast<uint16_t>( v.size() )); i+=2;
+        img.put_bytes(i, v.get_ptr(), v.size()); i+=v.size();
+        return i;
+    }
+
+    jau::POctets getBinaryValue(const jau::TROOctets& img, jau::nsize_t& i) {
+        const jau::nsize_t capacity = img.get_uint16(i); i+=2;
+        const jau::nsize_t size = img.get_uint16(i); i+=2;
+        img.check_range(i, size);
+        jau::POctets v(std::max(capacity, size), size, jau::endian::little);
+        v.put_bytes_nc(0, img.get_ptr_nc(i), size); i+=size;
+        return v;
+    }
+}
+
+jau::POctets DBGattServer::toBinary() {
+    if( Mode::DB != mode ) {
+        ERR_PRINT("Not in Mode::DB but %s, cannot be stored: %s", to_string(mode).c_str(), toString().c_str());
+        return jau::POctets(0, jau::endian::little);
+    }
+    jau::darray<std::shared_ptr<const jau::uuid_t>> uuids;
+    // 1st pass: UUID table and image size, validating all counts and sizes against their binary field width
+    jau::nsize_t size = 4 + 2 + 2 + 2 + 2;
+    if( services.size() > UINT16_MAX ) {
+        ERR_PRINT("Service count %zu exceeds binary image limit: %s", (size_t)services.size(), toString().c_str());
+        return jau::POctets(0, jau::endian::little);
+    }
+    for(DBGattServiceRef& s : services) {
+        uuidIndex(uuids, s->getType());
+        size += 1 + 2 + 2;
+        if( s->getCharacteristics().size() > UINT16_MAX ) {
+            ERR_PRINT("Characteristic count %zu exceeds binary image limit: %s", (size_t)s->getCharacteristics().size(), s->toString().c_str());
+            return jau::POctets(0, jau::endian::little);
+        }
+        for(DBGattCharRef& c : s->getCharacteristics()) {
+            uuidIndex(uuids, c->getValueType());
+            const DBGattValueRef snapshot = c->getValueSnapshot();
+            const jau::TROOctets& value = nullptr != snapshot ? *snapshot : c->getValue();
+            if( !isBinaryValueValid(value, c->getValue().capacity()) || c->getDescriptors().size() > UINT8_MAX ) {
+                ERR_PRINT("Value size %zu, capacity %zu or descriptor count %zu exceeds binary image limit: %s",
+                        (size_t)value.size(), (size_t)c->getValue().capacity(), (size_t)c->getDescriptors().size(), c->toString().c_str());
+                return jau::POctets(0, jau::endian::little);
+            }
+            size += 2 + 1 + 1 + binaryValueSize( value ) + 1;
+            for(DBGattDescRef& d : c->getDescriptors()) {
+                uuidIndex(uuids, d->getType());
+                const DBGattValueRef dsnapshot = d->getValueSnapshot();
+                const jau::TROOctets& dvalue = nullptr != dsnapshot ? *dsnapshot : d->getValue();
+                if( !isBinaryValueValid(dvalue, d->getValue().capacity()) ) {
+                    ERR_PRINT("Value size %zu or capacity %zu exceeds binary image limit: %s",
+                            (size_t)dvalue.size(), (size_t)d->getValue().capacity(), d->toString().c_str());
+                    return jau::POctets(0, jau::endian::little);
+                }
+                size += 2 + 1 + binaryValueSize( dvalue );
+            }
+        }
+    }
+    if( uuids.size() > UINT16_MAX ) {
+        ERR_PRINT("UUID count %zu exceeds binary image limit: %s", (size_t)uuids.size(), toString().c_str());
+        return jau::POctets(0, jau::endian::little);
+    }
+    for(const std::shared_ptr<const jau::uuid_t>& u : uuids) {
+        size += 1 + u->getTypeSizeInt();
+    }
+
+    // 2nd pass: Fill image
+    jau::POctets img(size, jau::endian::little);
+    jau::nsize_t i = 0;
+    img.put_uint32(i, BINARY_MAGIC); i+=4;
+    img.put_uint16(i, BINARY_VERSION); i+=2;
+    img.put_uint16(i, max_att_mtu); i+=2;
+    img.put_uint16(i, static_cast<uint16_t>(uuids.size())); i+=2;
+    img.put_uint16(i, static_cast<uint16_t>(services.size())); i+=2;
+    for(const std::shared_ptr<const jau::uuid_t>& u : uuids) {
+        img.put_uint8(i, static_cast<uint8_t>(u->getTypeSizeInt())); i+=1;
+        i += u->put(img.get_wptr(), i, true /* littleEndian */);
+    }
+    for(DBGattServiceRef& s : services) {
+        img.put_uint8(i, s->isPrimary() ? 1 : 0); i+=1;
+        img.put_uint16(i, static_cast<uint16_t>(uuidIndex(uuids, s->getType()))); i+=2;
+        img.put_uint16(i, static_cast<uint16_t>(s->getCharacteristics().size())); i+=2;
+        for(DBGattCharRef& c : s->getCharacteristics()) {
+            img.put_uint16(i, static_cast<uint16_t>(uuidIndex(uuids, c->getValueType()))); i+=2;
+            img.put_uint8(i, c->getProperties()); i+=1;
+            img.put_uint8(i, ( c->hasVariableLength() ? 0b01 : 0 ) | ( c->hasPerConnectionValue() ? 0b10 : 0 ) ); i+=1;
+            const DBGattValueRef snapshot = c->getValueSnapshot();
+            i = putBinaryValue(img, i, nullptr != snapshot ? *snapshot : c->getValue(), c->getValue().capacity());
+            img.put_uint8(i, static_cast<uint8_t>(c->getDescriptors().size())); i+=1;
+            for(DBGattDescRef& d : c->getDescriptors()) {
+                img.put_uint16(i, static_cast<uint16_t>(uuidIndex(uuids, d->getType()))); i+=2;
+                img.put_uint8(i, d->hasVariableLength() ? 0b01 : 0); i+=1;
+                const DBGattValueRef dsnapshot = d->getValueSnapshot();
+                i = putBinaryValue(img, i, nullptr != dsnapshot ? *dsnapshot : d->getValue(), d->getValue().capacity());
+            }
+        }
+    }
+    return img;
+}
+
+std::shared_ptr<DBGattServer> DBGattServer::fromBinary(const uint8_t* data, const jau::nsize_t size) noexcept {
+    try {
+        const jau::TROOctets img(data, size, jau::endian::little);
+        jau::nsize_t i = 0;
+        if( BINARY_MAGIC != img.get_uint32(i) ) {
+            ERR_PRINT("Invalid magic %s", jau::to_hexstring(img.get_uint32(i)).c_str());
+            return nullptr;
+        }
+        i+=4;
+        const uint16_t version = img.get_uint16(i); i+=2;
+        if( BINARY_VERSION != version ) {
+            ERR_PRINT("Unsupported version %u", (unsigned)version);
+            return nullptr;
+        }
+        const uint16_t max_att_mtu = img.get_uint16(i); i+=2;
+        const jau::nsize_t uuid_count = img.get_uint16(i); i+=2;
+        const jau::nsize_t service_count = img.get_uint16(i); i+=2;
+
+        jau::darray<std::shared_ptr<const jau::uuid_t>> uuids;
+        uuids.reserve(uuid_count);
+        for(jau::nsize_t j=0; j<uuid_count; ++j) {
+            const jau::nsize_t usize = img.get_uint8(i); i+=1;
+            const jau::uuid_t::TypeSize ts = jau::uuid_t::toTypeSize( usize ); // throws if invalid
+            img.check_range(i, usize);
+            uuids.push_back( std::shared_ptr<const jau::uuid_t>( img.get_uuid(i, ts) ) );
+            i += usize;
+        }
+        auto getUUID = [&]() -> const std::shared_ptr<const jau::uuid_t>& {
+            const jau::nsize_t idx = img.get_uint16(i); i+=2;
+            return uuids.at(idx); // throws if out of bounds
+        };
+
+        jau::darray<DBGattServiceRef> services;
+        services.reserve(service_count);
+        for(jau::nsize_t si=0; si<service_count; ++si) {
+            const bool primary = 0 != img.get_uint8(i); i+=1;
+            const std::shared_ptr<const jau::uuid_t>& stype = getUUID();
+            const jau::nsize_t char_count = img.get_uint16(i); i+=2;
+            jau::darray<DBGattCharRef> chars;
+            chars.reserve(char_count);
+            for(jau::nsize_t ci=0; ci<char_count; ++ci) {
+                const std::shared_ptr<const jau::uuid_t>& ctype = getUUID();
+                const BTGattChar::PropertyBitVal props = static_cast<BTGattChar::PropertyBitVal>( img.get_uint8(i) ); i+=1;
+                const uint8_t cflags = img.get_uint8(i); i+=1;
+                jau::POctets cvalue = getBinaryValue(img, i);
+                const jau::nsize_t desc_count = img.get_uint8(i); i+=1;
+                jau::darray<DBGattDescRef> descs;
+                descs.reserve(desc_count);
+                for(jau::nsize_t di=0; di<desc_count; ++di) {
+                    const std::shared_ptr<const jau::uuid_t>& dtype = getUUID();
+                    const uint8_t dflags = img.get_uint8(i); i+=1;
+                    descs.push_back( std::make_shared<DBGattDesc>(dtype, getBinaryValue(img, i), 0 != ( dflags & 0b01 ) ) );
+                }
+                DBGattCharRef c = std::make_shared<DBGattChar>(ctype, props, std::move(descs), std::move(cvalue), 0 != ( cflags & 0b01 ) );
+                c->setPerConnectionValue( 0 != ( cflags & 0b10 ) );
+                chars.push_back( c );
+            }
+            services.push_back( std::make_shared<DBGattService>(primary, stype, std::move(chars)) );
+        }
+        if( i != size ) {
+            ERR_PRINT("Trailing %zu bytes of %zu", (size_t)(size - i), (size_t)size);
+            return nullptr;
+        }
+        return std::make_shared<DBGattServer>(max_att_mtu, std::move(services));
+    } catch (std::exception &e) {
+        ERR_PRINT("Invalid image of %zu bytes: Caught exception %s", (size_t)size, e.what());
+    }
+    return nullptr;
+}
+
+bool DBGattServer::write(const std::string& fname, const bool overwrite) noexcept {
+    const jau::fs::file_stats fname_stat(fname);
+    if( fname_stat.exists() && ( !fname_stat.is_file() || !overwrite ) ) {
+        DBG_PRINT("DBGattServer::write: Not overwriting existing %s", fname_stat.to_string(true).c_str());
+        return false;
+    }
+    try {
+        const jau::POctets img = toBinary();
+        if( 0 == img.size() ) {
+            return false; // not storable, error printed by toBinary()
+        }
+        std::ofstream file(fname, std::ios::out | std::ios::binary | std::ios::trunc);
+        if ( !file.good() || !file.is_open() ) {
+            ERR_PRINT("File not open %s", fname.c_str());
+            return false;
+        }
+        file.write((const char*)img.get_ptr(), img.size());
+        const bool res = file.good();
+        file.close();
+        if( !res ) {
+            ERR_PRINT("Failed writing %zu bytes to %s", (size_t)img.size(), fname.c_str());
+        }
+        return res;
+    } catch (std::exception &e) {
+        ERR_PRINT("%s: Caught exception %s", fname.c_str(), e.what());
+    }
+    return false;
+}
+
+std::shared_ptr<DBGattServer> DBGattServer::read(const std::string& fname) noexcept {
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if( 0 > fd ) {
+        DBG_PRINT("DBGattServer::read: Failed opening %s, errno %d %s", fname.c_str(), errno, strerror(errno));
+        return nullptr;
+    }
+    struct ::stat st;
+    if( 0 != ::fstat(fd, &st) || 0 >= st.st_size ) {
+        ERR_PRINT("Invalid file %s", fname.c_str());
+        ::close(fd);
+        return nullptr;
+    }
+    const jau::nsize_t size = static_cast<jau::nsize_t>(st.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // mapping remains valid
+    if( MAP_FAILED == data ) {
+        ERR_PRINT("Failed mapping %s", fname.c_str());
+        return nullptr;
+    }
+    std::shared_ptr<DBGattServer> res = fromBinary(static_cast<const uint8_t*>(data), size);
+    ::munmap(data, size);
+    return res;
+}
+
 std::string DBGattServer::toString() const noexcept {
     return "DBSrv[mode "+to_string(mode)+", max mtu "+std::to_string(max_att_mtu)+", "+std::to_string(services.size())+" services, "+javaObjectToString()+"]";
 }
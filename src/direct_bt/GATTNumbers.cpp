@@ -279,6 +279,7 @@ std::string direct_bt::GattServiceTypeToString(const GattServiceType v) noexcept
     X(PERIPHERAL_PRIVACY_FLAG) \
     X(RECONNECTION_ADDRESS) \
     X(PERIPHERAL_PREFERRED_CONNECTION_PARAMETERS) \
+    X(CLIENT_SUPPORTED_FEATURES) \
     X(TEMPERATURE) \
     X(TEMPERATURE_CELSIUS) \
     X(TEMPERATURE_FAHRENHEIT) \
@@ -49,6 +49,7 @@ extern "C" {
     #include <sys/ioctl.h>
     #include <sys/socket.h>
     #include <poll.h>
+    #include <sys/eventfd.h>
 }
 
 namespace direct_bt {
@@ -107,8 +108,29 @@ int HCIComm::hci_close_dev(int dd) noexcept
 HCIComm::HCIComm(const uint16_t _dev_id, const uint16_t _channel) noexcept
 : dev_id( _dev_id ), channel( _channel ),
   socket_descriptor( hci_open_dev(_dev_id, _channel) ),
-  interrupted_intern(false), is_interrupted_extern(/* Null Type */), tid_read(0)
+  interrupted_intern(false), is_interrupted_extern(/* Null Type */),
+  wakeup_fd( ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) )
 {
+    if( 0 > wakeup_fd ) {
+        ERR_PRINT("HCIComm::ctor: eventfd failed: dev_id %u, channel %u", dev_id, channel);
+    }
+}
+
+HCIComm::~HCIComm() noexcept {
+    close();
+    if( 0 <= wakeup_fd ) {
+        ::close(wakeup_fd);
+        wakeup_fd = -1;
+    }
+}
+
+void HCIComm::wakeup() noexcept {
+    if( 0 <= wakeup_fd ) {
+        const uint64_t one = 1;
+        if( sizeof(one) != ::write(wakeup_fd, &one, sizeof(one)) && EAGAIN != errno ) {
+            ERR_PRINT("HCIComm::wakeup: write failed: dd %d", socket_descriptor.load());
+        }
+    }
 }
 
 void HCIComm::close() noexcept {
@@ -121,19 +143,7 @@ void HCIComm::close() noexcept {
     PERF_TS_T0();
     // interrupt ::read(..) and , avoiding prolonged hang
     interrupted_intern = true;
-    {
-        pthread_t _tid_read = tid_read;
-        tid_read = 0;
-        if( 0 != _tid_read ) {
-            pthread_t tid_self = pthread_self();
-            if( tid_self != _tid_read ) {
-                int kerr;
-                if( 0 != ( kerr = pthread_kill(_tid_read, SIGALRM) ) ) {
-                    ERR_PRINT("HCIComm::close: pthread_kill read %p FAILED: %d", (void*)_tid_read, kerr);
-                }
-            }
-        }
-    }
+    wakeup();
     hci_close_dev(socket_descriptor);
     socket_descriptor = -1;
     interrupted_intern = false;
@@ -150,19 +160,32 @@ jau::snsize_t HCIComm::read(uint8_t* buffer, const jau::nsize_t capacity, const
         goto done;
     }
 
-    if( !timeout.is_zero() ) {
-        struct pollfd p;
+    {
+        // block until data arrives, the optional timeout or wakeup()
+        struct pollfd p[2];
         int n;
-        const int32_t timeoutMS = timeout.to_num_of(jau::fractions_i64::milli);
+        const int32_t timeoutMS = timeout.is_zero() ? -1 : timeout.to_num_of(jau::fractions_i64::milli);
 
-        p.fd = socket_descriptor; p.events = POLLIN;
-        while ( !interrupted() && (n = ::poll(&p, 1, timeoutMS)) < 0 ) {
+        p[0].fd = socket_descriptor; p[0].events = POLLIN; p[0].revents = 0;
+        p[1].fd = wakeup_fd; p[1].events = POLLIN; p[1].revents = 0;
+        while ( !interrupted() && (n = ::poll(p, 0 <= wakeup_fd ? 2 : 1, timeoutMS)) < 0 ) {
             if ( !interrupted() && ( errno == EAGAIN || errno == EINTR ) ) {
                 // cont temp unavail or interruption
                 continue;
             }
             goto errout;
         }
+        if( interrupted() ) {
+            errno = EINTR;
+            goto errout;
+        }
+        if( 0 != p[1].revents ) {
+            uint64_t counter;
+            while( 0 > ::read(wakeup_fd, &counter, sizeof(counter)) && EINTR == errno ) { }
+            if( 0 == p[0].revents ) {
+                n = 0; // woken up w/o data
+            }
+        }
         if (!n) {
             errno = ETIMEDOUT;
             goto errout;
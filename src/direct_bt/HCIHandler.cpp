@@ -62,13 +62,14 @@ using namespace jau::fractions_i64_literals;
 
 HCIEnv::HCIEnv() noexcept
 : exploding( jau::environment::getExplodingProperties("direct_bt.hci") ),
-  HCI_READER_THREAD_POLL_TIMEOUT( jau::environment::getFractionProperty("direct_bt.hci.reader.timeout", 10_s, 1500_ms /* min */, 365_d /* max */) ),
+  HCI_READER_THREAD_POLL_TIMEOUT( jau::environment::getFractionProperty("direct_bt.hci.reader.timeout", 0_s, 0_s /* min */, 365_d /* max */) ),
   HCI_COMMAND_STATUS_REPLY_TIMEOUT( jau::environment::getFractionProperty("direct_bt.hci.cmd.status.timeout", 3_s, 1500_ms /* min */, 365_d /* max */) ),
   HCI_COMMAND_COMPLETE_REPLY_TIMEOUT( jau::environment::getFractionProperty("direct_bt.hci.cmd.complete.timeout", 10_s, 1500_ms /* min */, 365_d /* max */) ),
   HCI_COMMAND_POLL_PERIOD( jau::environment::getFractionProperty("direct_bt.hci.cmd.poll.period", 125_ms, 50_ms, 365_d) ),
   HCI_EVT_RING_CAPACITY( jau::environment::getInt32Property("direct_bt.hci.ringsize", 64, 64 /* min */, 1024 /* max */) ),
   DEBUG_EVENT( jau::environment::getBooleanProperty("direct_bt.debug.hci.event", false) ),
   DEBUG_SCAN_AD_EIR( jau::environment::getBooleanProperty("direct_bt.debug.hci.scan_ad_eir", false) ),
+  HCI_LE_THROUGHPUT_AUTO( jau::environment::getBooleanProperty("direct_bt.hci.le.throughput.auto", false) ),
   HCI_READ_PACKET_MAX_RETRY( HCI_EVT_RING_CAPACITY )
 {
 }
@@ -801,6 +802,7 @@ HCIHandler::HCIHandler(const uint16_t dev_id_, const BTMode btMode_) noexcept
         filter_set_opcbit(HCIOpcodeBit::LE_ENABLE_ENC, mask);
         filter_set_opcbit(HCIOpcodeBit::LE_LTK_REPLY_ACK, mask);
         filter_set_opcbit(HCIOpcodeBit::LE_LTK_REPLY_REJ, mask);
+        filter_set_opcbit(HCIOpcodeBit::LE_SET_DATA_LENGTH, mask);
         filter_set_opcbit(HCIOpcodeBit::LE_READ_PHY, mask);
         filter_set_opcbit(HCIOpcodeBit::LE_SET_DEFAULT_PHY, mask);
         filter_set_opcbit(HCIOpcodeBit::LE_SET_PHY, mask);
@@ -962,6 +964,8 @@ void HCIHandler::close() noexcept {
     resetAllStates(false);
 
     PERF_TS_TD("HCIHandler::close.1");
+    hci_reader_service.set_shall_stop();
+    comm.wakeup(); // interrupt blocking read()
     hci_reader_service.stop();
     comm.close();
     PERF_TS_TD("HCIHandler::close.X");
@@ -1586,6 +1590,47 @@ HCIStatusCode HCIHandler::le_set_phy(const uint16_t conn_handle, const BDAddress
     return status;
 }
 
+HCIStatusCode HCIHandler::le_set_data_length(const uint16_t conn_handle, const BDAddressAndType& peerAddressAndType,
+                                             const uint16_t tx_octets, const uint16_t tx_time) noexcept {
+    if( !is_set(le_ll_feats, LE_Features::LE_Data_Pkt_Len_Ext) ) {
+        WARN_PRINT("HCIHandler::le_set_data_length: LE_Data_Pkt_Len_Ext not supported, requested tx_octets %u", tx_octets);
+        return HCIStatusCode::UNSUPPORTED_FEATURE_OR_PARAM_VALUE;
+    }
+    if( 27 > tx_octets || tx_octets > 251 || 328 > tx_time || tx_time > 17040 ) {
+        WARN_PRINT("HCIHandler::le_set_data_length: Invalid parameter tx_octets %u, tx_time %u", tx_octets, tx_time);
+        return HCIStatusCode::INVALID_PARAMS;
+    }
+
+    HCIStatusCode status = check_open_connection("le_set_data_length", conn_handle, peerAddressAndType);
+    if( HCIStatusCode::SUCCESS != status ) {
+        return status;
+    }
+
+    struct hci_cp_le_set_data_length {
+        __le16   handle;
+        __le16   tx_octets;
+        __le16   tx_time;
+    } __packed;
+    struct hci_rp_le_set_data_length {
+        __u8     status;
+        __le16   handle;
+    } __packed;
+
+    HCIStructCommand<hci_cp_le_set_data_length> req0(HCIOpcode::LE_SET_DATA_LENGTH);
+    hci_cp_le_set_data_length * cp = req0.getWStruct();
+    cp->handle = jau::cpu_to_le(conn_handle);
+    cp->tx_octets = jau::cpu_to_le(tx_octets);
+    cp->tx_time = jau::cpu_to_le(tx_time);
+    const hci_rp_le_set_data_length * ev_dl;
+    std::unique_ptr<HCIEvent> ev = processCommandComplete(req0, &ev_dl, &status);
+
+    if( nullptr == ev || nullptr == ev_dl || HCIStatusCode::SUCCESS != status ) {
+        ERR_PRINT("HCIHandler::le_set_data_length: LE_SET_DATA_LENGTH: 0x%x (%s) - %s",
+                number(status), to_string(status).c_str(), toString().c_str());
+    }
+    return status;
+}
+
 HCIStatusCode HCIHandler::le_set_adv_param(const EUI48 &peer_bdaddr,
                                            const HCILEOwnAddressType own_mac_type,
                                            const HCILEOwnAddressType peer_mac_type,
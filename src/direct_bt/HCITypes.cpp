@@ -199,6 +199,7 @@ std::string to_string(const HCIOGF op) noexcept {
     X(LE_ENABLE_ENC) \
     X(LE_LTK_REPLY_ACK) \
     X(LE_LTK_REPLY_REJ) \
+    X(LE_SET_DATA_LENGTH) \
     X(LE_READ_PHY) \
     X(LE_SET_DEFAULT_PHY) \
     X(LE_SET_PHY) \
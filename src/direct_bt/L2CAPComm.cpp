@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <vector>
 #include <cstdio>
+#include <chrono>
 
 #include  <algorithm>
 
@@ -45,17 +46,24 @@
 
 extern "C" {
     #include <unistd.h>
+    #include <fcntl.h>
     #include <sys/socket.h>
+    #include <sys/ioctl.h>
+    #include <sys/uio.h>
     #include <poll.h>
-    #include <signal.h>
+    #include <sys/eventfd.h>
 }
 
 using namespace direct_bt;
 
 L2CAPEnv::L2CAPEnv() noexcept
 : exploding( jau::environment::getExplodingProperties("direct_bt.l2cap") ),
-  L2CAP_READER_POLL_TIMEOUT( jau::environment::getInt32Property("direct_bt.l2cap.reader.timeout", 10000, 1500 /* min */, INT32_MAX /* max */) ),
+  L2CAP_READER_POLL_TIMEOUT( jau::environment::getInt32Property("direct_bt.l2cap.reader.timeout", 0, 0 /* min */, INT32_MAX /* max */) ),
   L2CAP_RESTART_COUNT_ON_ERROR( jau::environment::getInt32Property("direct_bt.l2cap.restart.count", 5, INT32_MIN /* min */, INT32_MAX /* max */) ), // FIXME: Move to L2CAPComm
+  L2CAP_CONNECT_TIMEOUT( jau::environment::getInt32Property("direct_bt.l2cap.connect.timeout", 20000, 1000 /* min */, INT32_MAX /* max */) ),
+  L2CAP_SEND_QUEUE_CAPACITY( jau::environment::getInt32Property("direct_bt.l2cap.sendqueue.capacity", 32, 1 /* min */, 1024 /* max */) ),
+  L2CAP_LISTEN_BACKLOG( jau::environment::getInt32Property("direct_bt.l2cap.listen.backlog", 10, 1 /* min */, 4096 /* max */) ),
+  L2CAP_ACCEPT_WORKERS( jau::environment::getInt32Property("direct_bt.l2cap.accept.workers", 4, 1 /* min */, 64 /* max */) ),
   DEBUG_DATA( jau::environment::getBooleanProperty("direct_bt.debug.l2cap.data", false) )
 {
 }
@@ -128,14 +136,46 @@ int L2CAPComm::l2cap_close_dev(int dd) noexcept
     return ::close(dd);
 }
 
-L2CAPComm::L2CAPComm(const uint16_t adev_id_, const BDAddressAndType& localAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_) noexcept
+L2CAPComm::L2CAPComm(const uint16_t adev_id_, const BDAddressAndType& localAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_, const uint16_t rx_mtu_) noexcept
 : env(L2CAPEnv::get()),
   adev_id(adev_id_),
   localAddressAndType(localAddressAndType_),
-  psm(psm_), cid(cid_),
+  psm(psm_), cid(cid_), rx_mtu(rx_mtu_),
+  io_profile(L2CAPIOProfile::DEFAULT),
   socket_(-1),
-  is_open_(false), interrupted_intern(false), is_interrupted_extern(/* Null Type */)
-{ }
+  is_open_(false), interrupted_intern(false), is_interrupted_extern(/* Null Type */),
+  wakeup_fd( ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) ),
+  loopback_mtu(0)
+{
+    if( 0 > wakeup_fd ) {
+        ERR_PRINT("L2CAPComm::ctor: eventfd failed: dev_id %u, psm %s, cid %s",
+                  adev_id, to_string(psm).c_str(), to_string(cid).c_str());
+    }
+}
+
+L2CAPComm::~L2CAPComm() noexcept {
+    if( 0 <= wakeup_fd ) {
+        ::close(wakeup_fd);
+        wakeup_fd = -1;
+    }
+}
+
+void L2CAPComm::wakeup() noexcept {
+    if( 0 <= wakeup_fd ) {
+        const uint64_t one = 1;
+        if( sizeof(one) != ::write(wakeup_fd, &one, sizeof(one)) && EAGAIN != errno ) {
+            ERR_PRINT("L2CAPComm::wakeup: write failed: dev_id %u, dd %d, psm %s, cid %s",
+                      adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str());
+        }
+    }
+}
+
+void L2CAPComm::clear_wakeup() noexcept {
+    if( 0 <= wakeup_fd ) {
+        uint64_t counter;
+        while( 0 > ::read(wakeup_fd, &counter, sizeof(counter)) && EINTR == errno ) { }
+    }
+}
 
 bool L2CAPComm::setBTSecurityLevelImpl(const BTSecurityLevel sec_level, const BDAddressAndType& remoteAddressAndType) noexcept {
     if( BTSecurityLevel::NONE > sec_level ) {
@@ -189,6 +229,128 @@ bool L2CAPComm::setBTSecurityLevelImpl(const BTSecurityLevel sec_level, const BD
     }
 }
 
+bool L2CAPComm::setRxMTUImpl() noexcept {
+    if( 0 == rx_mtu ) {
+        return true;
+    }
+    // LE CoC: Kernel accepts BT_RCVMTU for a socket bound to an LE address, before connect() or listen().
+    // The initial credits granted to the remote are derived from this MTU, the MPS and the socket's receive buffer.
+    const uint16_t mtu = rx_mtu;
+    if( 0 > ::setsockopt(socket_, SOL_BLUETOOTH, BT_RCVMTU, &mtu, sizeof(mtu)) ) {
+        ERR_PRINT("L2CAP::setRxMTU: Failed: rx_mtu %u: dev_id %u, dd %d, psm %s, cid %s, local %s; %s",
+                  rx_mtu, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
+                  localAddressAndType.toString().c_str(), getStateString().c_str());
+        return false;
+    }
+    DBG_PRINT("L2CAP::setRxMTU: Success: rx_mtu %u: dev_id %u, dd %d, psm %s, cid %s, local %s",
+              rx_mtu, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
+              localAddressAndType.toString().c_str());
+    return true;
+}
+
+/**
+ * L2CAPIOProfile socket settings.
+ *
+ * SO_PRIORITY: Linux's HCI scheduler picks the ACL data of the highest priority first across all connections of an adapter, max 7.
+ * SO_SNDBUF: Bounds the data queued in the kernel ahead of a packet, doubled by the kernel and capped by net.core.wmem_max.
+ * SO_RCVBUF: Determines the LE CoC credits granted to the remote, capped by net.core.rmem_max.
+ */
+inline constexpr const int L2CAP_LOW_LATENCY_PRIORITY = 6;
+inline constexpr const int L2CAP_LOW_LATENCY_SNDBUF = 8 * 1024;
+inline constexpr const int L2CAP_BULK_PRIORITY = 0;
+inline constexpr const int L2CAP_BULK_SNDBUF = 256 * 1024;
+inline constexpr const int L2CAP_BULK_RCVBUF = 256 * 1024;
+
+bool L2CAPComm::setIOProfileImpl() noexcept {
+    const L2CAPIOProfile p = io_profile;
+    if( L2CAPIOProfile::DEFAULT == p ) {
+        return true;
+    }
+    const bool low_latency = L2CAPIOProfile::LOW_LATENCY == p;
+    const int priority = low_latency ? L2CAP_LOW_LATENCY_PRIORITY : L2CAP_BULK_PRIORITY;
+    const int sndbuf = low_latency ? L2CAP_LOW_LATENCY_SNDBUF : L2CAP_BULK_SNDBUF;
+    const int flushable = low_latency ? BT_FLUSHABLE_OFF : BT_FLUSHABLE_ON;
+    struct bt_power power;
+    bzero((void *)&power, sizeof(power));
+    power.force_active = low_latency ? BT_POWER_FORCE_ACTIVE_ON : BT_POWER_FORCE_ACTIVE_OFF;
+    bool res = true;
+
+    // Best effort, e.g. BT_FLUSHABLE_OFF requires a controller capable of non-flushable packets
+    // and BT_FLUSHABLE or BT_POWER are not applicable to every transport.
+    if( 0 > ::setsockopt(socket_, SOL_SOCKET, SO_PRIORITY, &priority, sizeof(priority)) ) {
+        DBG_PRINT("L2CAP::setIOProfile: SO_PRIORITY %d failed: dev_id %u, dd %d, psm %s, cid %s; %s",
+                  priority, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(), getStateString().c_str());
+        res = false;
+    }
+    if( 0 > ::setsockopt(socket_, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)) ) {
+        DBG_PRINT("L2CAP::setIOProfile: SO_SNDBUF %d failed: dev_id %u, dd %d, psm %s, cid %s; %s",
+                  sndbuf, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(), getStateString().c_str());
+        res = false;
+    }
+    if( !low_latency && 0 > ::setsockopt(socket_, SOL_SOCKET, SO_RCVBUF, &L2CAP_BULK_RCVBUF, sizeof(L2CAP_BULK_RCVBUF)) ) {
+        DBG_PRINT("L2CAP::setIOProfile: SO_RCVBUF %d failed: dev_id %u, dd %d, psm %s, cid %s; %s",
+                  L2CAP_BULK_RCVBUF, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(), getStateString().c_str());
+        res = false;
+    }
+    if( 0 > ::setsockopt(socket_, SOL_BLUETOOTH, BT_FLUSHABLE, &flushable, sizeof(flushable)) ) {
+        DBG_PRINT("L2CAP::setIOProfile: BT_FLUSHABLE %d failed: dev_id %u, dd %d, psm %s, cid %s; %s",
+                  flushable, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(), getStateString().c_str());
+        res = false;
+    }
+    if( 0 > ::setsockopt(socket_, SOL_BLUETOOTH, BT_POWER, &power, sizeof(power)) ) {
+        DBG_PRINT("L2CAP::setIOProfile: BT_POWER %u failed: dev_id %u, dd %d, psm %s, cid %s; %s",
+                  power.force_active, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(), getStateString().c_str());
+        res = false;
+    }
+    DBG_PRINT("L2CAP::setIOProfile: %s, res %d: dev_id %u, dd %d, psm %s, cid %s",
+              to_string(p).c_str(), res, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str());
+    return res;
+}
+
+bool L2CAPComm::setIOProfile(const L2CAPIOProfile p) noexcept {
+    io_profile = p;
+    if( !is_open_ || 0 > socket_ ) {
+        return true; // applied at open
+    }
+    return setIOProfileImpl();
+}
+
+L2CAP_PSM L2CAPComm::getBoundPSM() const noexcept {
+    if( !is_open_ || 0 > socket_ ) {
+        return L2CAP_PSM::UNDEFINED;
+    }
+    sockaddr_l2 a;
+    socklen_t addrlen = sizeof(a);
+    bzero((void *)&a, sizeof(a));
+    if( 0 > ::getsockname(socket_, (struct sockaddr*)&a, &addrlen) ) {
+        DBG_PRINT("L2CAP::getBoundPSM: getsockname failed: dev_id %u, dd %d, psm %s, cid %s, local %s",
+                  adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
+                  localAddressAndType.toString().c_str());
+        return L2CAP_PSM::UNDEFINED;
+    }
+    return static_cast<L2CAP_PSM>(jau::le_to_cpu(a.l2_psm));
+}
+
+/** Returns the uint16_t socket option `optname` at SOL_BLUETOOTH level, zero on failure. */
+static uint16_t l2cap_get_mtu(const int dd, const int optname) noexcept {
+    if( 0 > dd ) {
+        return 0;
+    }
+    uint16_t mtu = 0;
+    socklen_t optlen = sizeof(mtu);
+    if( 0 > ::getsockopt(dd, SOL_BLUETOOTH, optname, &mtu, &optlen) || optlen != sizeof(mtu) ) {
+        return 0;
+    }
+    return mtu;
+}
+
+uint16_t L2CAPComm::getRxMTU() const noexcept {
+    if( 0 < loopback_mtu ) {
+        return is_open_ ? loopback_mtu : 0;
+    }
+    return is_open_ ? l2cap_get_mtu(socket_, BT_RCVMTU) : 0;
+}
+
 BTSecurityLevel L2CAPComm::getBTSecurityLevelImpl(const BDAddressAndType& remoteAddressAndType) noexcept {
     BTSecurityLevel sec_level = BTSecurityLevel::UNSET;
     if constexpr ( USE_LINUX_BT_SECURITY ) {
@@ -234,36 +396,31 @@ BTSecurityLevel L2CAPComm::getBTSecurityLevelImpl(const BDAddressAndType& remote
 // *************************************************
 // *************************************************
 
-L2CAPClient::L2CAPClient(const uint16_t adev_id_, const BDAddressAndType& adapterAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_) noexcept
-: L2CAPComm(adev_id_, adapterAddressAndType_, psm_, cid_),
+L2CAPClient::L2CAPClient(const uint16_t adev_id_, const BDAddressAndType& adapterAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_,
+                         const uint16_t rx_mtu_) noexcept
+: L2CAPComm(adev_id_, adapterAddressAndType_, psm_, cid_, rx_mtu_),
   remoteAddressAndType(BDAddressAndType::ANY_BREDR_DEVICE),
-  has_ioerror(false), tid_connect(0), tid_read(0)
+  has_ioerror(false),
+  connect_deadline(0), connect_retry_count(0), connect_sec_level(BTSecurityLevel::UNSET),
+  send_queue(), send_queue_size(0), stats()
 { }
 
 L2CAPClient::L2CAPClient(const uint16_t adev_id_, const BDAddressAndType& adapterAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_,
-                         const BDAddressAndType& remoteAddressAndType_, int client_socket_) noexcept
-: L2CAPComm(adev_id_, adapterAddressAndType_, psm_, cid_),
+                         const BDAddressAndType& remoteAddressAndType_, int client_socket_, const uint16_t rx_mtu_) noexcept
+: L2CAPComm(adev_id_, adapterAddressAndType_, psm_, cid_, rx_mtu_),
   remoteAddressAndType(remoteAddressAndType_),
-  has_ioerror(false), tid_connect(0), tid_read(0)
+  has_ioerror(false),
+  connect_deadline(0), connect_retry_count(0), connect_sec_level(BTSecurityLevel::UNSET),
+  send_queue(), send_queue_size(0), stats()
 {
     socket_ = client_socket_;
     is_open_ = 0 <= client_socket_;
 }
 
-bool L2CAPClient::open(const BTDevice& device, const BTSecurityLevel sec_level) noexcept {
-
-    bool expOpen = false; // C++11, exp as value since C++20
-    if( !is_open_.compare_exchange_strong(expOpen, true) ) {
-        DBG_PRINT("L2CAPClient::open(%s, %s): Already open: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-                  device.getAddressAndType().toString().c_str(), to_string(sec_level).c_str(),
-                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                  to_string(psm).c_str(), to_string(cid).c_str(),
-                  getStateString().c_str());
-        return false;
-    }
-    const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
-
+void L2CAPClient::connectInit(const BTDevice& device, const BTSecurityLevel sec_level) noexcept {
     has_ioerror = false; // always clear last ioerror flag (should be redundant)
+    clear_wakeup(); // drop stale wakeup() signals of a previous connection
+    resetStats(); // per connection accounting
 
     /**
      * bt_io_connect ( create_io ) with source address
@@ -281,32 +438,51 @@ bool L2CAPClient::open(const BTDevice& device, const BTSecurityLevel sec_level)
      * -- connect(fd, ..)
      */
     remoteAddressAndType = device.getAddressAndType();
+    connect_deadline = jau::getCurrentMilliseconds() + static_cast<uint64_t>(env.L2CAP_CONNECT_TIMEOUT);
+    connect_retry_count = 0;
+    connect_sec_level = sec_level;
+}
 
+int L2CAPClient::connectStart() noexcept {
     /** BT Core Spec v5.2: Vol 3, Part A: L2CAP_CONNECTION_REQ */
     sockaddr_l2 req;
-    int res;
-    int to_retry_count=0; // ETIMEDOUT retry count
+    int flags;
 
-    DBG_PRINT("L2CAPClient::open: Start Connect: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
-              adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-              to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
-              getStateString().c_str());
-
-    socket_ = l2cap_open_dev(localAddressAndType, psm, cid);
+    if( 0 <= socket_ ) {
+        // retry with a new socket, a timed out L2CAP socket can't be connected again
+        l2cap_close_dev(socket_);
+        socket_ = -1;
+    }
+    // Bind w/o PSM, the remote SPSM is only passed to connect() below.
+    // Binding the remote's SPSM would reserve it locally, colliding with a local L2CAPServer on the same SPSM
+    // and requiring CAP_NET_BIND_SERVICE for fixed SPSMs below 0x80.
+    // Connecting an LE bound socket to an SPSM selects the LE credit based mode, i.e. LE CoC.
+    socket_ = l2cap_open_dev(localAddressAndType, L2CAP_PSM::UNDEFINED, cid);
 
     if( 0 > socket_ ) {
-        goto failure; // open failed
+        return -1; // open failed
+    }
+    if( !setRxMTUImpl() ) {
+        return -1; // LE CoC rx_mtu failed
     }
+    setIOProfileImpl(); // best effort, before connect() to size the LE CoC receive buffer
 
     if constexpr ( !SET_BT_SECURITY_POST_CONNECT && USE_LINUX_BT_SECURITY ) {
-        if( BTSecurityLevel::UNSET < sec_level ) {
-            if( !setBTSecurityLevelImpl(sec_level, remoteAddressAndType) ) {
-                goto failure; // sec_level failed
+        if( BTSecurityLevel::UNSET < connect_sec_level ) {
+            if( !setBTSecurityLevelImpl(connect_sec_level, remoteAddressAndType) ) {
+                return -1; // sec_level failed
             }
         }
     }
 
-    tid_connect = pthread_self(); // temporary safe tid to allow interruption
+    flags = ::fcntl(socket_, F_GETFL, 0);
+    if( 0 > flags || 0 > ::fcntl(socket_, F_SETFL, flags | O_NONBLOCK) ) {
+        ERR_PRINT("L2CAPClient::connect: Set O_NONBLOCK failed: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(),
+                  getStateString().c_str());
+        return -1;
+    }
 
     // actual request to connect to remote device
     bzero((void *)&req, sizeof(req));
@@ -316,59 +492,141 @@ bool L2CAPClient::open(const BTDevice& device, const BTSecurityLevel sec_level)
     req.l2_cid = jau::cpu_to_le(direct_bt::number(cid));
     req.l2_bdaddr_type = ::number(remoteAddressAndType.type);
 
-    while( !interrupted() ) {
-        // blocking
-        res = ::connect(socket_, (struct sockaddr*)&req, sizeof(req));
-
-        DBG_PRINT("L2CAPClient::open: Connect Result: %d, errno 0x%X %s, dev_id %u, %s, psm %s, cid %s",
-                  res, errno, strerror(errno),
-                  adev_id, remoteAddressAndType.toString().c_str(),
-                  to_string(psm).c_str(), to_string(cid).c_str());
-
-        if( !res )
-        {
-            break; // done
+    // non-blocking, completion signaled by poll() POLLOUT
+    const int res = ::connect(socket_, (struct sockaddr*)&req, sizeof(req));
+
+    DBG_PRINT("L2CAPClient::connect: Connect Start: %d, errno 0x%X %s, dev_id %u, %s, psm %s, cid %s, retry %d",
+              res, errno, strerror(errno),
+              adev_id, remoteAddressAndType.toString().c_str(),
+              to_string(psm).c_str(), to_string(cid).c_str(), connect_retry_count);
+
+    if( 0 == res ) {
+        return connectProgress(true /* writable */); // done
+    } else if( EINPROGRESS == errno || EAGAIN == errno ) {
+        return 1;
+    } else if( !interrupted() ) {
+        // EALREADY == errno || ENETUNREACH == errno || EHOSTUNREACH == errno || ..
+        ERR_PRINT("L2CAPClient::connect: Connect failed: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(), to_string(connect_sec_level).c_str(),
+                  getStateString().c_str());
+    }
+    return -1;
+}
 
-        } else if( ETIMEDOUT == errno ) {
-            to_retry_count++;
-            if( to_retry_count < number(Defaults::L2CAP_CONNECT_MAX_RETRY) ) {
-                WORDY_PRINT("L2CAPClient::open: Connect timeout, retry %d: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
-                          to_retry_count,
-                          adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                          to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
-                          getStateString().c_str());
-                continue;
-            } else {
-                ERR_PRINT("L2CAPClient::open: Connect timeout, retried %d: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
-                          to_retry_count,
-                          adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                          to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
-                          getStateString().c_str());
-                goto failure; // exit
+int L2CAPClient::connectProgress(const bool writable) noexcept {
+    if( !is_open_ || interrupted() || 0 > socket_ ) {
+        return -1; // exit on close or interrupt
+    }
+    int err = ETIMEDOUT;
+    if( writable ) {
+        socklen_t optlen = sizeof(err);
+        if( 0 > ::getsockopt(socket_, SOL_SOCKET, SO_ERROR, &err, &optlen) ) {
+            err = errno;
+        }
+    }
+    if( 0 == err ) {
+        // success, back to blocking I/O
+        const int flags = ::fcntl(socket_, F_GETFL, 0);
+        if( 0 > flags || 0 > ::fcntl(socket_, F_SETFL, flags & ~O_NONBLOCK) ) {
+            ERR_PRINT("L2CAPClient::connect: Clear O_NONBLOCK failed: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                      adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                      to_string(psm).c_str(), to_string(cid).c_str(),
+                      getStateString().c_str());
+            return -1;
+        }
+        if constexpr ( SET_BT_SECURITY_POST_CONNECT && USE_LINUX_BT_SECURITY ) {
+            if( BTSecurityLevel::UNSET < connect_sec_level ) {
+                if( !setBTSecurityLevelImpl(connect_sec_level, remoteAddressAndType) ) {
+                    return -1; // sec_level failed
+                }
             }
-
-        } else if( !interrupted() ) {
-            // EALREADY == errno || ENETUNREACH == errno || EHOSTUNREACH == errno || ..
-            ERR_PRINT("L2CAPClient::open: Connect failed: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+        }
+        DBG_PRINT("L2CAPClient::connect: Connected: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s, retry %d",
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(), to_string(connect_sec_level).c_str(),
+                  connect_retry_count);
+        return 0;
+    }
+    errno = err;
+    if( ETIMEDOUT == err ) {
+        const bool deadline_passed = jau::getCurrentMilliseconds() >= connect_deadline;
+        connect_retry_count++;
+        if( !deadline_passed && connect_retry_count < number(Defaults::L2CAP_CONNECT_MAX_RETRY) ) {
+            WORDY_PRINT("L2CAPClient::connect: Connect timeout, retry %d: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+                      connect_retry_count,
                       adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                      to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
+                      to_string(psm).c_str(), to_string(cid).c_str(), to_string(connect_sec_level).c_str(),
                       getStateString().c_str());
-            goto failure; // exit
-        } else {
-            goto failure; // exit on interrupt
+            return connectStart();
         }
+        ERR_PRINT("L2CAPClient::connect: Connect timeout, retried %d, deadline passed %d: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+                  connect_retry_count, deadline_passed,
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(), to_string(connect_sec_level).c_str(),
+                  getStateString().c_str());
+    } else if( !interrupted() ) {
+        ERR_PRINT("L2CAPClient::connect: Connect failed: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(), to_string(connect_sec_level).c_str(),
+                  getStateString().c_str());
     }
-    // success
-    tid_connect = 0;
+    return -1;
+}
+
+bool L2CAPClient::open(const BTDevice& device, const BTSecurityLevel sec_level) noexcept {
+
+    bool expOpen = false; // C++11, exp as value since C++20
+    if( !is_open_.compare_exchange_strong(expOpen, true) ) {
+        DBG_PRINT("L2CAPClient::open(%s, %s): Already open: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                  device.getAddressAndType().toString().c_str(), to_string(sec_level).c_str(),
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(),
+                  getStateString().c_str());
+        return false;
+    }
+    const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
 
-    if constexpr ( SET_BT_SECURITY_POST_CONNECT && USE_LINUX_BT_SECURITY ) {
-        if( BTSecurityLevel::UNSET < sec_level ) {
-            if( !setBTSecurityLevelImpl(sec_level, remoteAddressAndType) ) {
-                goto failure; // sec_level failed
+    connectInit(device, sec_level);
+
+    DBG_PRINT("L2CAPClient::open: Start Connect: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+              adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+              to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
+              getStateString().c_str());
+
+    int res = connectStart();
+    while( 1 == res ) {
+        // blocking until writable, connect failure, deadline or wakeup()
+        const uint64_t now = jau::getCurrentMilliseconds();
+        const int timeoutMS = now < connect_deadline ? static_cast<int>( std::min<uint64_t>(connect_deadline - now, INT32_MAX) ) : 0;
+        struct pollfd p[2];
+        p[0].fd = socket_; p[0].events = POLLOUT; p[0].revents = 0;
+        p[1].fd = wakeup_fd; p[1].events = POLLIN; p[1].revents = 0;
+        const int n = 0 < timeoutMS ? ::poll(p, 0 <= wakeup_fd ? 2 : 1, timeoutMS) : 0;
+        if( 0 > n ) {
+            if( ( EAGAIN == errno || EINTR == errno ) && !interrupted() ) {
+                continue; // cont temp unavail or interruption
             }
+            res = -1;
+            break;
         }
+        if( 0 != p[1].revents ) {
+            clear_wakeup();
+            if( interrupted() ) {
+                errno = EINTR;
+                res = -1;
+                break;
+            }
+            if( 0 == p[0].revents ) {
+                continue; // spurious wakeup
+            }
+        }
+        res = connectProgress( 0 < n );
     }
 
+    if( 0 != res ) {
+        goto failure;
+    }
     return true;
 
 failure:
@@ -378,6 +636,37 @@ failure:
     return false;
 }
 
+bool L2CAPClient::openAsync(const BTDevice& device, const BTSecurityLevel sec_level, const connect_callback_t& cb) noexcept {
+    bool expOpen = false; // C++11, exp as value since C++20
+    if( !is_open_.compare_exchange_strong(expOpen, true) ) {
+        DBG_PRINT("L2CAPClient::openAsync(%s, %s): Already open: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                  device.getAddressAndType().toString().c_str(), to_string(sec_level).c_str(),
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(),
+                  getStateString().c_str());
+        return false;
+    }
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
+
+        connectInit(device, sec_level);
+
+        DBG_PRINT("L2CAPClient::openAsync: Start Connect: dev_id %u, dd %d, %s, psm %s, cid %s, sec_level %s; %s",
+                  adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+                  to_string(psm).c_str(), to_string(cid).c_str(), to_string(sec_level).c_str(),
+                  getStateString().c_str());
+
+        // an immediately completed connect is progressed by the scheduler as well
+        if( 0 <= connectStart() && L2CAPConnectScheduler::get().add(*this, cb) ) {
+            return true;
+        }
+    }
+    const int err = errno;
+    close();
+    errno = err;
+    return false;
+}
+
 bool L2CAPClient::close() noexcept {
     bool expOpen = true; // C++11, exp as value since C++20
     if( !is_open_.compare_exchange_strong(expOpen, false) ) {
@@ -389,6 +678,12 @@ bool L2CAPClient::close() noexcept {
         set_interrupted_query(L2CAPComm::get_boolean_callback_t()); // Null-Type
         return true;
     }
+    // interrupt connect() and read() before locking, avoiding prolonged hang
+    interrupted_intern = true;
+    wakeup();
+
+    // cancel a pending openAsync() before locking, as the scheduler locks mtx_write while progressing it
+    L2CAPConnectScheduler::get().remove(*this);
     const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
 
     DBG_PRINT("L2CAPClient::close: Start: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
@@ -399,41 +694,13 @@ bool L2CAPClient::close() noexcept {
     set_interrupted_query(L2CAPComm::get_boolean_callback_t()); // Null-Type
     PERF_TS_T0();
 
-    // interrupt connect() and read(), avoiding prolonged hang
-    interrupted_intern = true;
-    {
-        pthread_t tid_self = pthread_self();
-        pthread_t _tid_connect = tid_connect;
-        pthread_t _tid_read = tid_read;
-        tid_read = 0;
-        tid_connect = 0;
-
-        // interrupt read(), avoiding prolonged hang
-        if( 0 != _tid_read && tid_self != _tid_read ) {
-            int kerr;
-            if( 0 != ( kerr = pthread_kill(_tid_read, SIGALRM) ) ) {
-                ERR_PRINT("L2CAPClient::close: pthread_kill read %p FAILED: %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-                          (void*)_tid_read, kerr,
-                          adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                          to_string(psm).c_str(), to_string(cid).c_str(),
-                          getStateString().c_str());
-            }
-        }
-        // interrupt connect(), avoiding prolonged hang
-        if( 0 != _tid_connect && _tid_read != _tid_connect && tid_self != _tid_connect ) {
-            int kerr;
-            if( 0 != ( kerr = pthread_kill(_tid_connect, SIGALRM) ) ) {
-                ERR_PRINT("L2CAPClient::close: Start: pthread_kill connect %p FAILED: %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-                          (void*)_tid_connect, kerr,
-                          adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
-                          to_string(psm).c_str(), to_string(cid).c_str(),
-                          getStateString().c_str());
-            }
-        }
-    }
-
     l2cap_close_dev(socket_);
     socket_ = -1;
+    {
+        const std::lock_guard<std::mutex> lock_queue(mtx_queue); // RAII-style acquire and relinquish via destructor
+        send_queue.clear();
+        send_queue_size = 0;
+    }
     interrupted_intern = false;
     PERF_TS_TD("L2CAPClient::close");
     DBG_PRINT("L2CAPClient::close: End: dev_id %u, dd %d, %s, psm %s, cid %s; %s",
@@ -478,6 +745,13 @@ BTSecurityLevel L2CAPClient::getBTSecurityLevel() noexcept {
     return getBTSecurityLevelImpl(remoteAddressAndType);
 }
 
+uint16_t L2CAPClient::getTxMTU() const noexcept {
+    if( 0 < loopback_mtu ) {
+        return is_open_ ? loopback_mtu : 0;
+    }
+    return is_open_ ? l2cap_get_mtu(socket_, BT_SNDMTU) : 0;
+}
+
 #define RWEXITCODE_ENUM(X) \
         X(RWExitCode, SUCCESS) \
         X(RWExitCode, NOT_OPEN) \
@@ -487,7 +761,8 @@ BTSecurityLevel L2CAPClient::getBTSecurityLevel() noexcept {
         X(RWExitCode, POLL_TIMEOUT) \
         X(RWExitCode, READ_ERROR) \
         X(RWExitCode, READ_TIMEOUT) \
-        X(RWExitCode, WRITE_ERROR)
+        X(RWExitCode, WRITE_ERROR) \
+        X(RWExitCode, QUEUE_FULL)
 
 #define CASE2_TO_STRING(U,V) case U::V: return #V;
 
@@ -502,8 +777,7 @@ std::string L2CAPClient::getRWExitCodeString(const RWExitCode ec) noexcept {
     return "Unknown ExitCode";
 }
 
-jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) noexcept {
-    const int32_t timeoutMS = env.L2CAP_READER_POLL_TIMEOUT;
+jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity, const int32_t timeoutMS) noexcept {
     jau::snsize_t len = 0;
     jau::snsize_t err_res = 0;
 
@@ -523,14 +797,20 @@ jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) no
         goto done;
     }
 
-    tid_read = pthread_self(); // temporary safe tid to allow interruption
-
-    if( timeoutMS ) {
-        struct pollfd p;
+    {
+        // block until data arrives, writeQueued() packets can be flushed, the optional timeout or wakeup()
+        struct pollfd p[2];
+        const nfds_t p_count = 0 <= wakeup_fd ? 2 : 1;
+        bool pollout = true; // cleared while a writer holds mtx_write, which wakes us up after unlocking
         int n;
 
-        p.fd = socket_; p.events = POLLIN;
-        while ( is_open_ && !interrupted() && ( n = ::poll( &p, 1, timeoutMS ) ) < 0 ) {
+        p[0].fd = socket_;
+        p[1].fd = wakeup_fd; p[1].events = POLLIN;
+poll_again:
+        // also wait for writability while writeQueued() packets are pending
+        p[0].events = pollout && 0 < send_queue_size ? POLLIN | POLLOUT : POLLIN;
+        p[0].revents = 0; p[1].revents = 0;
+        while ( is_open_ && !interrupted() && ( n = ::poll( p, p_count, 0 < timeoutMS ? timeoutMS : -1 ) ) < 0 ) {
             if( !is_open_ ) {
                 err_res = number(RWExitCode::NOT_OPEN);
                 goto errout;
@@ -541,6 +821,7 @@ jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) no
             }
             if ( errno == EAGAIN || errno == EINTR ) {
                 // cont temp unavail or interruption
+                count(stats.eagain_retries);
                 continue;
             }
             if( errno == ETIMEDOUT ) {
@@ -550,11 +831,42 @@ jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) no
             }
             goto errout;
         }
+        if( !is_open_ ) {
+            err_res = number(RWExitCode::NOT_OPEN);
+            goto errout;
+        }
+        if( interrupted() ) {
+            err_res = number(RWExitCode::INTERRUPTED);
+            goto errout;
+        }
+        if( 0 != p[1].revents ) {
+            clear_wakeup();
+            pollout = true;
+            if( 0 == p[0].revents ) {
+                // woken up w/o data, e.g. to re-evaluate the caller's state or a new writeQueued() packet
+                if( 0 < send_queue_size ) {
+                    goto poll_again;
+                }
+                n = 0;
+            }
+        }
         if ( 0 == n ) {
             err_res = number(RWExitCode::POLL_TIMEOUT);
             errno = ETIMEDOUT;
             goto errout;
         }
+        if( 0 != ( p[0].revents & POLLOUT ) ) {
+            // readiness driven flush, skipped if a writer holds the lock as it flushes itself
+            std::unique_lock<std::recursive_mutex> lock(mtx_write, std::try_to_lock);
+            if( lock.owns_lock() ) {
+                flushQueuedImpl(true /* nonblocking */);
+            } else {
+                pollout = false; // no busy polling of the writable socket, the writer wakes us up when done
+            }
+            if( 0 == ( p[0].revents & ~POLLOUT ) ) {
+                goto poll_again; // writable only
+            }
+        }
     }
 
     while ( is_open_ && !interrupted() && ( len = ::read(socket_, buffer, capacity) ) < 0 ) {
@@ -568,6 +880,7 @@ jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) no
         }
         if ( errno == EAGAIN || errno == EINTR ) {
             // cont temp unavail or interruption
+            count(stats.eagain_retries);
             continue;
         }
         if( errno == ETIMEDOUT ) {
@@ -579,11 +892,14 @@ jau::snsize_t L2CAPClient::read(uint8_t* buffer, const jau::nsize_t capacity) no
     }
 
 done:
-    tid_read = 0;
+    if( 0 < len ) {
+        count(stats.reads);
+        count(stats.bytes_read, static_cast<uint64_t>(len));
+    }
     return len;
 
 errout:
-    tid_read = 0;
+    countError(err_res, true /* is_read */);
     if( err_res == number(RWExitCode::NOT_OPEN) ) {
         WORDY_PRINT("L2CAPClient::read: Not open res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
               err_res, getRWExitCodeString(err_res).c_str(), len,
@@ -625,7 +941,123 @@ errout:
 }
 
 jau::snsize_t L2CAPClient::write(const uint8_t * buffer, const jau::nsize_t length) noexcept {
-    const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
+    return writev(buffer, length, nullptr, 0);
+}
+
+jau::snsize_t L2CAPClient::writev(const uint8_t * header, const jau::nsize_t header_length,
+                                  const uint8_t * payload, const jau::nsize_t payload_length) noexcept {
+    jau::snsize_t res;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
+        res = 0 < send_queue_size ? flushQueuedImpl(false /* nonblocking */) : 0; // keep packet order, blocking flush of pending writeQueued() packets
+        if( 0 <= res ) {
+            res = sendImpl(header, header_length, payload, payload_length, false /* nonblocking */);
+        }
+    }
+    if( 0 < send_queue_size ) {
+        wakeup(); // let the reader flush packets queued while we held mtx_write
+    }
+    return res;
+}
+
+jau::snsize_t L2CAPClient::writeQueued(const uint8_t * header, const jau::nsize_t header_length,
+                                       const uint8_t * payload, const jau::nsize_t payload_length) noexcept {
+    const jau::nsize_t length = header_length + payload_length;
+    if( 0 == length ) {
+        return 0;
+    }
+    {
+        // direct send attempt only if no other writer holds the lock, never blocking on it
+        std::unique_lock<std::recursive_mutex> lock(mtx_write, std::try_to_lock);
+        if( lock.owns_lock() ) {
+            if( 0 < send_queue_size ) {
+                const jau::snsize_t res = flushQueuedImpl(true /* nonblocking */);
+                if( 0 > res ) {
+                    return res;
+                }
+            }
+            if( 0 == send_queue_size ) {
+                const jau::snsize_t len = sendImpl(header, header_length, payload, payload_length, true /* nonblocking */);
+                if( 0 != len ) {
+                    return len; // sent or error
+                }
+            }
+        }
+    }
+    const std::lock_guard<std::mutex> lock_queue(mtx_queue); // RAII-style acquire and relinquish via destructor
+    if( send_queue.size() >= static_cast<jau::nsize_t>(env.L2CAP_SEND_QUEUE_CAPACITY) ) {
+        DBG_PRINT("L2CAPClient::writeQueued: Queue full, %zu packets; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+              (size_t)send_queue.size(),
+              adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+              to_string(psm).c_str(), to_string(cid).c_str(),
+              getStateString().c_str());
+        count(stats.queue_full);
+        return number(RWExitCode::QUEUE_FULL);
+    }
+    jau::POctets packet(length, jau::endian::little);
+    if( 0 < header_length ) {
+        packet.put_bytes_nc(0, header, header_length);
+    }
+    if( 0 < payload_length ) {
+        packet.put_bytes_nc(header_length, payload, payload_length);
+    }
+    const bool was_empty = send_queue.empty();
+    send_queue.push_back( std::move(packet) );
+    send_queue_size = send_queue.size();
+    if( was_empty ) {
+        wakeup(); // let a blocking read() also poll for writability
+    }
+    return length;
+}
+
+jau::snsize_t L2CAPClient::flushQueued() noexcept {
+    jau::snsize_t res;
+    {
+        const std::lock_guard<std::recursive_mutex> lock(mtx_write); // RAII-style acquire and relinquish via destructor
+        res = flushQueuedImpl(true /* nonblocking */);
+    }
+    if( 0 < res ) {
+        wakeup(); // let the reader flush the remainder once writable
+    }
+    return res;
+}
+
+jau::snsize_t L2CAPClient::flushQueuedImpl(const bool nonblocking) noexcept {
+    // Caller holds mtx_write, the only one popping packets, hence mtx_queue is not held while sending.
+    for(;;) {
+        jau::POctets packet(0, jau::endian::little);
+        {
+            const std::lock_guard<std::mutex> lock_queue(mtx_queue); // RAII-style acquire and relinquish via destructor
+            if( send_queue.empty() ) {
+                return 0;
+            }
+            packet = std::move( send_queue[0] );
+            send_queue.erase(send_queue.cbegin());
+        }
+        const jau::snsize_t len = sendImpl(packet.get_ptr(), packet.size(), nullptr, 0, nonblocking);
+        const std::lock_guard<std::mutex> lock_queue(mtx_queue); // RAII-style acquire and relinquish via destructor
+        if( 0 > len ) {
+            send_queue.clear();
+            send_queue_size = 0;
+            return len;
+        }
+        if( 0 == len ) {
+            // socket's send queue full or closed, keep packet order
+            send_queue.insert(send_queue.cbegin(), std::move(packet));
+            send_queue_size = send_queue.size();
+            return send_queue.size();
+        }
+        send_queue_size = send_queue.size();
+    }
+}
+
+jau::snsize_t L2CAPClient::sendImpl(const uint8_t * header, const jau::nsize_t header_length,
+                                    const uint8_t * payload, const jau::nsize_t payload_length, const bool nonblocking) noexcept {
+    const jau::nsize_t length = header_length + payload_length;
+    const int flags = nonblocking ? MSG_NOSIGNAL | MSG_DONTWAIT : MSG_NOSIGNAL;
+    struct iovec iov[2];
+    struct msghdr msg;
+    int iovcnt = 0;
     jau::snsize_t len = 0;
     jau::snsize_t err_res = 0;
 
@@ -644,32 +1076,128 @@ jau::snsize_t L2CAPClient::write(const uint8_t * buffer, const jau::nsize_t leng
     if( 0 == length ) {
         goto done;
     }
+    if( 0 < loopback_mtu && length > loopback_mtu ) {
+        errno = EMSGSIZE; // emulating the kernel's L2CAP socket
+        err_res = number(RWExitCode::WRITE_ERROR);
+        goto errout;
+    }
+    if( 0 < header_length ) {
+        iov[iovcnt].iov_base = const_cast<uint8_t*>(header);
+        iov[iovcnt++].iov_len = header_length;
+    }
+    if( 0 < payload_length ) {
+        iov[iovcnt].iov_base = const_cast<uint8_t*>(payload);
+        iov[iovcnt++].iov_len = payload_length;
+    }
+    bzero((void *)&msg, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovcnt;
 
-    while ( is_open_ && !interrupted() && ( len = ::write(socket_, buffer, length) ) < 0 ) {
-        if( !is_open_ ) {
-            err_res = number(RWExitCode::NOT_OPEN);
-            goto errout;
+    {
+        const jau::fraction_timespec t0 = nonblocking ? jau::fraction_timespec() : jau::getMonotonicTime();
+
+        // SOCK_SEQPACKET: one sendmsg() call results in one packet
+        while ( is_open_ && !interrupted() && ( len = ::sendmsg(socket_, &msg, flags) ) < 0 ) {
+            if( !is_open_ ) {
+                err_res = number(RWExitCode::NOT_OPEN);
+                break;
+            }
+            if( interrupted() ) {
+                err_res = number(RWExitCode::INTERRUPTED);
+                break;
+            }
+            if( nonblocking && ( EAGAIN == errno || EWOULDBLOCK == errno ) ) {
+                // socket's send queue full
+                count(stats.eagain_retries);
+                len = 0;
+                break;
+            }
+            if( EAGAIN == errno || EINTR == errno ) {
+                // cont temp unavail or interruption
+                count(stats.eagain_retries);
+                continue;
+            }
+            err_res = number(RWExitCode::WRITE_ERROR);
+            break;
         }
-        if( interrupted() ) {
-            err_res = number(RWExitCode::INTERRUPTED);
-            goto errout;
+        if( !nonblocking ) {
+            count(stats.write_blocked_us, static_cast<uint64_t>(
+                    ( jau::getMonotonicTime() - t0 ).to_fraction_i64().to_num_of(jau::fractions_i64::micro) ) );
         }
-        if( EAGAIN == errno || EINTR == errno ) {
-            // cont temp unavail or interruption
-            continue;
+        if( 0 != err_res ) {
+            goto errout;
         }
-        err_res = number(RWExitCode::WRITE_ERROR);
-        goto errout;
     }
 
 done:
+    if( 0 < len ) {
+        count(stats.writes);
+        count(stats.bytes_written, static_cast<uint64_t>(len));
+    }
     return len;
 
 errout:
+    countError(err_res, false /* is_read */);
+    logWriteError(nonblocking ? "L2CAPClient::writeQueued" : "L2CAPClient::write", err_res, len);
+    return err_res;
+}
+
+void L2CAPClient::countError(const jau::snsize_t err_res, const bool is_read) noexcept {
+    switch( toRWExitCode(err_res) ) {
+        case RWExitCode::SUCCESS:
+        case RWExitCode::NOT_OPEN:
+        case RWExitCode::INVALID_SOCKET_DD:
+            break;
+        case RWExitCode::INTERRUPTED:
+            count(stats.interrupts);
+            break;
+        case RWExitCode::POLL_TIMEOUT:
+            count(stats.poll_timeouts);
+            break;
+        case RWExitCode::QUEUE_FULL:
+            count(stats.queue_full);
+            break;
+        default:
+            count(is_read ? stats.read_errors : stats.write_errors);
+            break;
+    }
+}
+
+L2CAPStats L2CAPClient::getStats() const noexcept {
+    L2CAPStats res;
+    res.reads = stats.reads.load(std::memory_order_relaxed);
+    res.bytes_read = stats.bytes_read.load(std::memory_order_relaxed);
+    res.writes = stats.writes.load(std::memory_order_relaxed);
+    res.bytes_written = stats.bytes_written.load(std::memory_order_relaxed);
+    res.eagain_retries = stats.eagain_retries.load(std::memory_order_relaxed);
+    res.poll_timeouts = stats.poll_timeouts.load(std::memory_order_relaxed);
+    res.interrupts = stats.interrupts.load(std::memory_order_relaxed);
+    res.read_errors = stats.read_errors.load(std::memory_order_relaxed);
+    res.write_errors = stats.write_errors.load(std::memory_order_relaxed);
+    res.queue_full = stats.queue_full.load(std::memory_order_relaxed);
+    res.write_blocked_us = stats.write_blocked_us.load(std::memory_order_relaxed);
+    return res;
+}
+
+void L2CAPClient::resetStats() noexcept {
+    stats.reads = 0;
+    stats.bytes_read = 0;
+    stats.writes = 0;
+    stats.bytes_written = 0;
+    stats.eagain_retries = 0;
+    stats.poll_timeouts = 0;
+    stats.interrupts = 0;
+    stats.read_errors = 0;
+    stats.write_errors = 0;
+    stats.queue_full = 0;
+    stats.write_blocked_us = 0;
+}
+
+void L2CAPClient::logWriteError(const char* prefix, const jau::snsize_t err_res, const jau::snsize_t len) noexcept {
     if( err_res == number(RWExitCode::NOT_OPEN) || err_res == number(RWExitCode::INTERRUPTED) ) {
         // closed or intentionally interrupted
-        WORDY_PRINT("L2CAPClient::write: IRQed res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-              err_res, getRWExitCodeString(err_res).c_str(), len,
+        WORDY_PRINT("%s: IRQed res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+              prefix, err_res, getRWExitCodeString(err_res).c_str(), len,
               adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
               to_string(psm).c_str(), to_string(cid).c_str(),
               getStateString().c_str());
@@ -678,20 +1206,74 @@ errout:
         has_ioerror = true;
 
         if( env.L2CAP_RESTART_COUNT_ON_ERROR < 0 ) {
-            ABORT("L2CAPClient::write: Error res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-                  err_res, getRWExitCodeString(err_res).c_str(), len,
+            ABORT("%s: Error res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                  prefix, err_res, getRWExitCodeString(err_res).c_str(), len,
                   adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
                   to_string(psm).c_str(), to_string(cid).c_str(),
                   getStateString().c_str());
         } else {
-            IRQ_PRINT("L2CAPClient::write: Error res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
-                  err_res, getRWExitCodeString(err_res).c_str(), len,
+            IRQ_PRINT("%s: Error res %d (%s), len %d; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+                  prefix, err_res, getRWExitCodeString(err_res).c_str(), len,
                   adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
                   to_string(psm).c_str(), to_string(cid).c_str(),
                   getStateString().c_str());
         }
     }
-    return err_res;
+}
+
+jau::snsize_t L2CAPClient::getTxQueueSpace() noexcept {
+    if( !is_open_ ) {
+        return number(RWExitCode::NOT_OPEN);
+    }
+    if( 0 > socket_ ) {
+        return number(RWExitCode::INVALID_SOCKET_DD);
+    }
+    int space = 0;
+    if( 0 > ::ioctl(socket_, TIOCOUTQ, &space) ) {
+        DBG_PRINT("L2CAPClient::getTxQueueSpace: ioctl failed; dev_id %u, dd %d, %s, psm %s, cid %s; %s",
+              adev_id, socket_.load(), remoteAddressAndType.toString().c_str(),
+              to_string(psm).c_str(), to_string(cid).c_str(),
+              getStateString().c_str());
+        return number(RWExitCode::POLL_ERROR);
+    }
+    return space;
+}
+
+jau::snsize_t L2CAPClient::waitWritable(const jau::fraction_i64& timeout) noexcept {
+    if( !is_open_ ) {
+        return number(RWExitCode::NOT_OPEN);
+    }
+    if( interrupted() ) {
+        return number(RWExitCode::INTERRUPTED);
+    }
+    if( 0 > socket_ ) {
+        return number(RWExitCode::INVALID_SOCKET_DD);
+    }
+    struct pollfd p;
+    int n = 0;
+
+    p.fd = socket_; p.events = POLLOUT;
+    while ( is_open_ && !interrupted() && ( n = ::poll( &p, 1, static_cast<int>( timeout.to_ms() ) ) ) < 0 ) {
+        if ( errno == EAGAIN || errno == EINTR ) {
+            // cont temp unavail or interruption
+            continue;
+        }
+        return number(RWExitCode::POLL_ERROR);
+    }
+    if( !is_open_ ) {
+        return number(RWExitCode::NOT_OPEN);
+    }
+    if( interrupted() ) {
+        return number(RWExitCode::INTERRUPTED);
+    }
+    if ( 0 == n ) {
+        errno = ETIMEDOUT;
+        return number(RWExitCode::POLL_TIMEOUT);
+    }
+    if( 0 != ( p.revents & ( POLLERR | POLLHUP | POLLNVAL ) ) ) {
+        return number(RWExitCode::POLL_ERROR);
+    }
+    return 0;
 }
 
 std::string L2CAPClient::toString() const noexcept {
@@ -707,8 +1289,310 @@ std::string L2CAPClient::toString() const noexcept {
 // *************************************************
 // *************************************************
 
-L2CAPServer::L2CAPServer(const uint16_t adev_id_, const BDAddressAndType& localAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_) noexcept
-: L2CAPComm(adev_id_, localAddressAndType_, psm_, cid_), tid_accept(0)
+L2CAPConnectScheduler::L2CAPConnectScheduler() noexcept
+: pending(), in_progress(nullptr), running(false), worker_id()
+{
+    if( 0 > ::pipe2(wakeup_fd, O_CLOEXEC | O_NONBLOCK) ) {
+        ERR_PRINT("L2CAPConnectScheduler: pipe failed");
+        wakeup_fd[0] = -1;
+        wakeup_fd[1] = -1;
+    }
+}
+
+L2CAPConnectScheduler::~L2CAPConnectScheduler() noexcept {
+    std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+    pending.clear();
+    if( running && 0 <= wakeup_fd[1] ) {
+        const uint8_t b = 1;
+        if( 0 > ::write(wakeup_fd[1], &b, 1) ) { } // ignore, non-blocking pipe may be full
+    }
+    cv_pending.wait_for(lock, std::chrono::milliseconds(1000), [this]{ return !running; });
+    if( !running ) {
+        ::close(wakeup_fd[0]);
+        ::close(wakeup_fd[1]);
+    }
+}
+
+bool L2CAPConnectScheduler::add(L2CAPClient& client, const L2CAPClient::connect_callback_t& cb) noexcept {
+    std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+    if( 0 > wakeup_fd[0] ) {
+        return false;
+    }
+    pending.push_back( Pending{ &client, cb } );
+    if( !running ) {
+        running = true;
+        std::thread w(&L2CAPConnectScheduler::worker, this); // @suppress("Invalid arguments")
+        w.detach();
+    } else {
+        const uint8_t b = 1;
+        if( 0 > ::write(wakeup_fd[1], &b, 1) ) { } // ignore, non-blocking pipe may be full while a wakeup is pending anyways
+    }
+    DBG_PRINT("L2CAPConnectScheduler::add: pending %zu, %s", (size_t)pending.size(), client.toString().c_str());
+    return true;
+}
+
+bool L2CAPConnectScheduler::remove(L2CAPClient& client) noexcept {
+    L2CAPClient::connect_callback_t cb;
+    {
+        std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+        if( std::this_thread::get_id() != worker_id ) {
+            cv_pending.wait(lock, [&]{ return &client != in_progress; });
+        }
+        auto it = std::find_if(pending.begin(), pending.end(), [&](const Pending& p) { return &client == p.client; });
+        if( it == pending.end() ) {
+            return false;
+        }
+        cb = it->cb;
+        pending.erase(it);
+    }
+    DBG_PRINT("L2CAPConnectScheduler::remove: Cancelled %s", client.toString().c_str());
+    cb(false);
+    return true;
+}
+
+jau::nsize_t L2CAPConnectScheduler::getPendingCount() noexcept {
+    std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+    return pending.size();
+}
+
+void L2CAPConnectScheduler::worker() noexcept {
+    jau::darray<struct pollfd> pfds;
+    jau::darray<L2CAPClient*> clients;
+    {
+        std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+        worker_id = std::this_thread::get_id();
+    }
+    DBG_PRINT("L2CAPConnectScheduler::worker: Start");
+    while( true ) {
+        // snapshot of pending sockets and the nearest deadline
+        uint64_t deadline = UINT64_MAX;
+        pfds.clear();
+        clients.clear();
+        {
+            std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+            if( pending.empty() ) {
+                running = false;
+                worker_id = std::thread::id();
+                cv_pending.notify_all();
+                break;
+            }
+            pfds.push_back( { wakeup_fd[0], POLLIN, 0 } );
+            for(const Pending& p : pending) {
+                pfds.push_back( { p.client->socket(), POLLOUT, 0 } );
+                clients.push_back( p.client );
+                deadline = std::min(deadline, p.client->connect_deadline);
+            }
+        }
+        const uint64_t now = jau::getCurrentMilliseconds();
+        const int timeoutMS = now < deadline ? static_cast<int>( std::min<uint64_t>(deadline - now, INT32_MAX) ) : 0;
+        const int n = ::poll(pfds.data(), pfds.size(), timeoutMS);
+        if( 0 > n && EAGAIN != errno && EINTR != errno ) {
+            ERR_PRINT("L2CAPConnectScheduler::worker: poll failed");
+        }
+        if( 0 < n && 0 != ( pfds[0].revents & POLLIN ) ) {
+            uint8_t buf[16];
+            while( 0 < ::read(wakeup_fd[0], buf, sizeof(buf)) ) { } // drain wakeup signals
+        }
+        const uint64_t t1 = jau::getCurrentMilliseconds();
+        for(jau::nsize_t i=0; i<clients.size(); ++i) {
+            L2CAPClient* client = clients[i];
+            const bool writable = 0 < n && 0 != pfds[i+1].revents;
+            {
+                std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+                if( pending.end() == std::find_if(pending.begin(), pending.end(), [&](const Pending& p) { return client == p.client; }) ) {
+                    continue; // removed in the meantime, client may be destructed
+                }
+                if( !writable && t1 < client->connect_deadline && !client->interrupted() ) {
+                    continue; // still connecting
+                }
+                in_progress = client;
+            }
+            int res;
+            {
+                const std::lock_guard<std::recursive_mutex> lock(client->mutex_write()); // RAII-style acquire and relinquish via destructor
+                res = client->connectProgress(writable);
+            }
+            if( 1 != res ) {
+                L2CAPClient::connect_callback_t cb;
+                {
+                    std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+                    auto it = std::find_if(pending.begin(), pending.end(), [&](const Pending& p) { return client == p.client; });
+                    cb = it->cb;
+                    pending.erase(it);
+                }
+                if( 0 != res ) {
+                    client->close(); // not pending anymore, hence no recursion
+                }
+                cb(0 == res);
+            }
+            {
+                std::unique_lock<std::mutex> lock(mtx_pending); // RAII-style acquire and relinquish via destructor
+                in_progress = nullptr;
+            }
+            cv_pending.notify_all();
+        }
+    }
+    DBG_PRINT("L2CAPConnectScheduler::worker: End");
+}
+
+// *************************************************
+// *************************************************
+// *************************************************
+
+L2CAPLoopback::L2CAPLoopback(const uint16_t mtu_, const jau::fraction_i64& latency) noexcept
+: mtu( std::max(mtu_, L2CAPComm::LE_COC_MIN_MTU) ),
+  latency_us( static_cast<uint64_t>( std::max<int64_t>(0, latency.to_num_of(jau::fractions_i64::micro)) ) ),
+  relay_fd{-1, -1}, stop_fd(-1)
+{
+    int dd[2] = { -1, -1 };
+    if( 0 == latency_us ) {
+        // direct connection
+        if( 0 > ::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, dd) ) {
+            ERR_PRINT("L2CAPLoopback::ctor: socketpair failed");
+            dd[0] = -1; dd[1] = -1;
+        }
+    } else {
+        // each channel connected to the relay thread
+        int sp0[2] = { -1, -1 }, sp1[2] = { -1, -1 };
+        stop_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if( 0 > stop_fd ||
+            0 > ::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sp0) ||
+            0 > ::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sp1) ||
+            0 > ::fcntl(sp0[1], F_SETFL, O_NONBLOCK) ||
+            0 > ::fcntl(sp1[1], F_SETFL, O_NONBLOCK) )
+        {
+            ERR_PRINT("L2CAPLoopback::ctor: relay setup failed");
+            for(int fd : { sp0[0], sp0[1], sp1[0], sp1[1], stop_fd }) {
+                if( 0 <= fd ) { ::close(fd); }
+            }
+            stop_fd = -1;
+        } else {
+            dd[0] = sp0[0]; relay_fd[0] = sp0[1];
+            dd[1] = sp1[0]; relay_fd[1] = sp1[1];
+        }
+    }
+    for(int i=0; i<2; ++i) {
+        channel[i] = std::make_unique<L2CAPClient>(0 /* adev_id */, BDAddressAndType::ANY_DEVICE, L2CAP_PSM::UNDEFINED, L2CAP_CID::ATT,
+                                                   BDAddressAndType::ANY_DEVICE, dd[i]);
+        channel[i]->loopback_mtu = mtu;
+    }
+    if( 0 <= stop_fd ) {
+        relay = std::thread(&L2CAPLoopback::relayWork, this); // @suppress("Invalid arguments")
+    }
+    DBG_PRINT("L2CAPLoopback::ctor: %s", toString().c_str());
+}
+
+L2CAPLoopback::~L2CAPLoopback() noexcept {
+    channel[0]->close();
+    channel[1]->close();
+    if( relay.joinable() ) {
+        const uint64_t one = 1;
+        if( sizeof(one) != ::write(stop_fd, &one, sizeof(one)) ) {
+            ERR_PRINT("L2CAPLoopback::dtor: stop signal failed");
+        }
+        relay.join();
+    }
+    for(int fd : { relay_fd[0], relay_fd[1], stop_fd }) {
+        if( 0 <= fd ) { ::close(fd); }
+    }
+}
+
+static uint64_t loopback_now_us() noexcept {
+    return static_cast<uint64_t>( jau::getMonotonicTime().to_fraction_i64().to_num_of(jau::fractions_i64::micro) );
+}
+
+void L2CAPLoopback::relayWork() noexcept {
+    // pending[i] holds the packets received from channel i, delivered to channel 1-i once due
+    jau::darray<Packet> pending[2];
+    bool readable[2] = { true, true };
+    bool shutdown_sent[2] = { false, false };
+    jau::POctets rbuffer(mtu, jau::endian::little);
+
+    DBG_PRINT("L2CAPLoopback::relay: Start: %s", toString().c_str());
+    while( true ) {
+        // deliver due packets in order
+        uint64_t now = loopback_now_us();
+        bool blocked = false;
+        for(int i=0; i<2; ++i) {
+            while( !pending[i].empty() && pending[i][0].due_us <= now ) {
+                const jau::POctets& data = pending[i][0].data;
+                if( 0 > ::send(relay_fd[1-i], data.get_ptr(), data.size(), MSG_NOSIGNAL | MSG_DONTWAIT) ) {
+                    if( EAGAIN == errno || EWOULDBLOCK == errno || EINTR == errno ) {
+                        blocked = true; // receiver's socket buffer full, retry
+                        break;
+                    }
+                    pending[i].clear(); // receiver closed
+                    break;
+                }
+                pending[i].erase(pending[i].begin());
+            }
+            if( !readable[i] && pending[i].empty() && !shutdown_sent[1-i] ) {
+                // channel i closed: end the other channel's stream after all its packets have been delivered
+                ::shutdown(relay_fd[1-i], SHUT_RDWR);
+                shutdown_sent[1-i] = true;
+            }
+        }
+        if( !readable[0] && !readable[1] && pending[0].empty() && pending[1].empty() ) {
+            break; // both channels closed
+        }
+        int timeoutMS = -1;
+        if( blocked ) {
+            timeoutMS = 1;
+        } else {
+            for(int i=0; i<2; ++i) {
+                if( !pending[i].empty() ) {
+                    const uint64_t due = pending[i][0].due_us;
+                    const int t = due > now ? static_cast<int>( ( due - now + 999 ) / 1000 ) : 0;
+                    timeoutMS = 0 > timeoutMS ? t : std::min(timeoutMS, t);
+                }
+            }
+        }
+        struct pollfd p[3];
+        p[0].fd = stop_fd; p[0].events = POLLIN; p[0].revents = 0;
+        p[1].fd = readable[0] ? relay_fd[0] : -1; p[1].events = POLLIN; p[1].revents = 0;
+        p[2].fd = readable[1] ? relay_fd[1] : -1; p[2].events = POLLIN; p[2].revents = 0;
+        const int n = ::poll(p, 3, timeoutMS);
+        if( 0 > n ) {
+            if( EAGAIN == errno || EINTR == errno ) {
+                continue;
+            }
+            ERR_PRINT("L2CAPLoopback::relay: poll failed");
+            break;
+        }
+        if( 0 != p[0].revents ) {
+            break; // stopped
+        }
+        now = loopback_now_us();
+        for(int i=0; i<2; ++i) {
+            if( 0 == p[i+1].revents ) {
+                continue;
+            }
+            const ssize_t len = ::recv(relay_fd[i], rbuffer.get_wptr(), rbuffer.size(), MSG_DONTWAIT);
+            if( 0 < len ) {
+                Packet packet { now + latency_us, jau::POctets(static_cast<jau::nsize_t>(len), jau::endian::little) };
+                packet.data.put_bytes_nc(0, rbuffer.get_ptr(), static_cast<jau::nsize_t>(len));
+                pending[i].push_back( std::move(packet) );
+            } else if( 0 == len || ( EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno ) ) {
+                readable[i] = false; // channel i closed
+            }
+        }
+    }
+    DBG_PRINT("L2CAPLoopback::relay: End: %s", toString().c_str());
+}
+
+std::string L2CAPLoopback::toString() const noexcept {
+    return "L2CAPLoopback[mtu "+std::to_string(mtu)+", latency "+std::to_string(latency_us)+" us, relay "+std::to_string(0 <= stop_fd)+
+            ", dd["+std::to_string(channel[0]->socket())+", "+std::to_string(channel[1]->socket())+"]"+
+            ", open "+std::to_string(isOpen())+"]";
+}
+
+// *************************************************
+// *************************************************
+// *************************************************
+
+L2CAPServer::L2CAPServer(const uint16_t adev_id_, const BDAddressAndType& localAddressAndType_, const L2CAP_PSM psm_, const L2CAP_CID cid_,
+                         const uint16_t rx_mtu_) noexcept
+: L2CAPComm(adev_id_, localAddressAndType_, psm_, cid_, rx_mtu_)
 { }
 
 bool L2CAPServer::open() noexcept {
@@ -726,13 +1610,18 @@ bool L2CAPServer::open() noexcept {
               adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
               localAddressAndType.toString().c_str());
 
+    clear_wakeup(); // drop stale wakeup() signals of a previous session
     socket_ = l2cap_open_dev(localAddressAndType, psm, cid);
 
     if( 0 > socket_ ) {
         goto failure; // open failed
     }
+    if( !setRxMTUImpl() ) {
+        goto failure; // LE CoC rx_mtu failed
+    }
+    setIOProfileImpl(); // best effort, also applied to each accepted channel
 
-    res = ::listen(socket_, 10);
+    res = ::listen(socket_, env.L2CAP_LISTEN_BACKLOG);
 
     DBG_PRINT("L2CAPServer::open: End: res %d, dev_id %u, dd %d, psm %s, cid %s, local %s",
               res, adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
@@ -773,21 +1662,7 @@ bool L2CAPServer::close() noexcept {
 
     // interrupt accept(..), avoiding prolonged hang
     interrupted_intern = true;
-    {
-        pthread_t tid_self = pthread_self();
-        pthread_t _tid_accept = tid_accept;
-        tid_accept = 0;
-
-        if( 0 != _tid_accept && tid_self != _tid_accept ) {
-            int kerr;
-            if( 0 != ( kerr = pthread_kill(_tid_accept, SIGALRM) ) ) {
-                ERR_PRINT("L2CAPServer::close: Start: pthread_kill connect %p FAILED: %d; dev_id %u, dd %d, psm %s, cid %s, local %s",
-                          (void*)_tid_accept, kerr,
-                          adev_id, socket_.load(), to_string(psm).c_str(), to_string(cid).c_str(),
-                          localAddressAndType.toString().c_str());
-            }
-        }
-    }
+    wakeup();
 
     l2cap_close_dev(socket_);
     socket_ = -1;
@@ -800,11 +1675,17 @@ bool L2CAPServer::close() noexcept {
 }
 
 std::unique_ptr<L2CAPClient> L2CAPServer::accept() noexcept {
+    return acceptImpl(-1 /* infinite */);
+}
+
+std::unique_ptr<L2CAPClient> L2CAPServer::acceptPending() noexcept {
+    return acceptImpl(0 /* non-blocking */);
+}
+
+std::unique_ptr<L2CAPClient> L2CAPServer::acceptImpl(const int timeoutMS) noexcept {
     sockaddr_l2 peer;
     int to_retry_count=0; // ETIMEDOUT retry count
 
-    tid_accept = pthread_self(); // temporary safe tid to allow interruption
-
     if( !is_open_ ) {
         ERR_PRINT("L2CAPServer::accept: Not open: dev_id %u, dd[s %d], errno 0x%X %s, psm %s, cid %s, local %s",
                   adev_id, socket_.load(), errno, strerror(errno),
@@ -814,7 +1695,31 @@ std::unique_ptr<L2CAPClient> L2CAPServer::accept() noexcept {
     }
 
     while( is_open_ && !interrupted() ) {
-        // blocking
+        // blocking until a connection is pending or wakeup(), unless non-blocking
+        if( 0 <= wakeup_fd || 0 <= timeoutMS ) {
+            struct pollfd p[2];
+            p[0].fd = socket_; p[0].events = POLLIN; p[0].revents = 0;
+            p[1].fd = wakeup_fd; p[1].events = POLLIN; p[1].revents = 0;
+            const int n = ::poll(p, 0 <= wakeup_fd ? 2 : 1, timeoutMS);
+            if( 0 > n ) {
+                if( EAGAIN == errno || EINTR == errno ) {
+                    continue; // cont temp unavail or interruption
+                }
+                break; // exit
+            }
+            if( 0 == n ) {
+                return nullptr; // none pending
+            }
+            if( 0 <= wakeup_fd && 0 != p[1].revents ) {
+                clear_wakeup();
+                if( 0 == p[0].revents ) {
+                    if( 0 <= timeoutMS ) {
+                        return nullptr; // none pending
+                    }
+                    continue; // re-evaluate state
+                }
+            }
+        }
         bzero((void *)&peer, sizeof(peer));
         socklen_t addrlen = sizeof(peer); // on return it will contain the actual size of the peer address
         int client_socket = ::accept(socket_, (struct sockaddr*)&peer, &addrlen);
@@ -832,8 +1737,9 @@ std::unique_ptr<L2CAPClient> L2CAPServer::accept() noexcept {
                       localAddressAndType.toString().c_str(),
                       remoteAddressAndType.toString().c_str());
             // success
-            tid_accept = 0;
-            return std::make_unique<L2CAPClient>(adev_id, localAddressAndType, c_psm, c_cid, remoteAddressAndType, client_socket);
+            std::unique_ptr<L2CAPClient> client = std::make_unique<L2CAPClient>(adev_id, localAddressAndType, c_psm, c_cid, remoteAddressAndType, client_socket, rx_mtu);
+            client->setIOProfile(io_profile); // best effort, not all options are inherited from the listening socket
+            return client;
         } else if( ETIMEDOUT == errno ) {
             to_retry_count++;
             if( to_retry_count < L2CAPClient::number(L2CAPClient::Defaults::L2CAP_CONNECT_MAX_RETRY) ) {
@@ -866,7 +1772,6 @@ std::unique_ptr<L2CAPClient> L2CAPServer::accept() noexcept {
         }
     }
     // failure
-    tid_accept = 0;
     return nullptr;
 }
 
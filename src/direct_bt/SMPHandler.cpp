@@ -221,6 +221,8 @@ bool SMPHandler::disconnect(const bool disconnectDevice, const bool ioErrorCause
     }
 
     PERF3_TS_TD("SMPHandler::disconnect.1");
+    smp_reader_service.set_shall_stop();
+    l2cap.wakeup(); // interrupt blocking read()
     const bool smp_service_stop_res = smp_reader_service.stop();
     l2cap.close();
     PERF3_TS_TD("SMPHandler::disconnect.2");
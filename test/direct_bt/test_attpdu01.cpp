@@ -28,3 +28,115 @@ TEST_CASE( "ATT PDU Test 01", "[datatype][attpdu]" ) {
     REQUIRE(req.getEndHandle() == 0xffff);
 }
 
+
+TEST_CASE( "ATT PDU Test 02 Read Multiple and Multiple Handle Value Notification", "[datatype][attpdu]" ) {
+    {
+        const jau::darray<uint16_t> handles = { 0x0003, 0x0005, 0x0010 };
+        const AttReadMultipleReq req(true /* variable */, handles);
+        REQUIRE( req.isVariable() );
+        REQUIRE( 3 == req.getHandleCount() );
+        REQUIRE( 0x0005 == req.getHandle(1) );
+
+        std::unique_ptr<const AttPDUMsg> pdu = AttPDUMsg::getSpecialized(req.pdu.get_ptr(), req.pdu.size());
+        REQUIRE( AttPDUMsg::Opcode::READ_MULTIPLE_VARIABLE_REQ == pdu->getOpcode() );
+        const AttReadMultipleReq* req2 = static_cast<const AttReadMultipleReq*>(pdu.get());
+        REQUIRE( 3 == req2->getHandleCount() );
+        REQUIRE( 0x0010 == req2->getHandle(2) );
+    }
+    {
+        const uint8_t v1[] = { 1, 2, 3, 4, 5 };
+        const jau::TROOctets value(v1, sizeof(v1), jau::endian::little);
+
+        AttReadMultipleRsp rsp(true /* variable */, 1 + 2 + 5 + 2 + 3); // 2nd value truncated
+        REQUIRE( true == rsp.addValue(value) );
+        REQUIRE( false == rsp.addValue(value) );
+        REQUIRE( 1 + 2 + 5 + 2 + 3 == rsp.pdu.size() );
+        REQUIRE( 5 == rsp.pdu.get_uint16_nc(1 + 2 + 5) ); // full length of truncated value
+
+        AttReadMultipleRsp rsp2(false /* variable */, 1 + 8);
+        REQUIRE( true == rsp2.addValue(value) );
+        REQUIRE( false == rsp2.addValue(value) );
+        REQUIRE( 1 + 8 == rsp2.pdu.size() );
+    }
+    {
+        const uint8_t v1[] = { 1, 2, 3, 4, 5 };
+        const jau::TROOctets value(v1, sizeof(v1), jau::endian::little);
+
+        AttMultipleHandleValueNtf ntf(23);
+        REQUIRE( 0 == ntf.getTupleCount() );
+        REQUIRE( true == ntf.addHandleValue(0x0003, value) );
+        REQUIRE( true == ntf.addHandleValue(0x0005, value) );
+        REQUIRE( false == ntf.addHandleValue(0x0007, value) ); // 1 + 9 + 9 + 9 > 23
+        REQUIRE( 2 == ntf.getTupleCount() );
+        REQUIRE( 1 + 9 + 9 == ntf.pdu.size() );
+
+        std::unique_ptr<const AttPDUMsg> pdu = AttPDUMsg::getSpecialized(ntf.pdu.get_ptr(), ntf.pdu.size());
+        REQUIRE( AttPDUMsg::Opcode::MULTIPLE_HANDLE_VALUE_NTF == pdu->getOpcode() );
+        const AttMultipleHandleValueNtf* ntf2 = static_cast<const AttMultipleHandleValueNtf*>(pdu.get());
+        REQUIRE( 2 == ntf2->getTupleCount() );
+
+        // client side split into per handle notifications
+        uint16_t handle = 0;
+        jau::nsize_t value_size = 0;
+        jau::nsize_t offset = ntf2->getTuple(1, handle, value_size);
+        REQUIRE( 1 + 9 == offset );
+        REQUIRE( 0x0003 == handle );
+        REQUIRE( sizeof(v1) == value_size );
+        REQUIRE( 0 == memcmp(v1, ntf2->pdu.get_ptr() + 1 + 4, sizeof(v1)) );
+        offset = ntf2->getTuple(offset, handle, value_size);
+        REQUIRE( 1 + 9 + 9 == offset );
+        REQUIRE( 0x0005 == handle );
+        REQUIRE( 0 == ntf2->getTuple(offset, handle, value_size) ); // end
+
+        // truncated tuple is not returned
+        const AttMultipleHandleValueNtf ntf3(ntf.pdu.get_ptr(), ntf.pdu.size() - 1);
+        REQUIRE( 1 == ntf3.getTupleCount() );
+        REQUIRE( 0 == ntf3.getTuple(1 + 9, handle, value_size) );
+    }
+}
+
+TEST_CASE( "ATT PDU Test 03 Handle Value Receive View", "[datatype][attpdu]" ) {
+    const uint8_t v1[] = { 1, 2, 3, 4, 5 };
+    const jau::TROOctets value(v1, sizeof(v1), jau::endian::little);
+    {
+        const AttHandleValueRcv ntf(true /* isNotify */, 0x0003, value, 23);
+        REQUIRE( true == AttHandleValueRcvView::isValid(ntf.pdu.get_ptr(), ntf.pdu.size()) );
+
+        const AttHandleValueRcvView view(ntf.pdu.get_ptr(), ntf.pdu.size());
+        REQUIRE( true == view.isNotification() );
+        REQUIRE( 0x0003 == view.getHandle() );
+        REQUIRE( sizeof(v1) == view.getValue().size() );
+        REQUIRE( ntf.pdu.get_ptr() + 3 == view.getValue().get_ptr() ); // no copy
+        REQUIRE( 0 == memcmp(v1, view.getValue().get_ptr(), sizeof(v1)) );
+    }
+    {
+        const AttHandleValueRcv ind(false /* isNotify */, 0x0005, value, 23);
+        const AttHandleValueRcvView view(ind.pdu.get_ptr(), ind.pdu.size());
+        REQUIRE( true == view.isIndication() );
+        REQUIRE( 0x0005 == view.getHandle() );
+    }
+    {
+        const AttReadReq req(0x0003);
+        REQUIRE( false == AttHandleValueRcvView::isValid(req.pdu.get_ptr(), req.pdu.size()) );
+        const uint8_t shortNtf[] = { AttPDUMsg::number(AttPDUMsg::Opcode::HANDLE_VALUE_NTF), 0x03 };
+        REQUIRE( false == AttHandleValueRcvView::isValid(shortNtf, sizeof(shortNtf)) );
+    }
+}
+
+TEST_CASE( "ATT PDU Test 04 Read Blob Response Offset", "[datatype][attpdu]" ) {
+    // BT Core Spec v5.2: Vol 3, Part F ATT: 3.4.4.5 ATT_READ_BLOB_REQ, e.g. a 2 octet CCCD value
+    jau::POctets cccd(2, jau::endian::little);
+    cccd.put_uint16_nc(0, 0x0001);
+    {
+        const AttReadNRsp rsp(true /* blobRsp */, cccd, 1);
+        REQUIRE( AttPDUMsg::Opcode::READ_BLOB_RSP == rsp.getOpcode() );
+        REQUIRE( 1 == rsp.getPDUValueSize() );
+    }
+    {
+        const AttReadNRsp rsp(true /* blobRsp */, cccd, 2); // value_size == value_offset -> OK, ends communication
+        REQUIRE( 0 == rsp.getPDUValueSize() );
+    }
+    // value_offset > value_size must be rejected w/o underflow, server replies INVALID_OFFSET
+    REQUIRE_THROWS_AS( AttReadNRsp(true /* blobRsp */, cccd, 3), AttValueException );
+    REQUIRE_THROWS_AS( AttReadNRsp(true /* blobRsp */, cccd, 0xffff), AttValueException );
+}
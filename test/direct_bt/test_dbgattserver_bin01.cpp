@@ -0,0 +1,185 @@
+/**
+ * Author: agent <agent@local>
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+#include <jau/test/catch2_ext.hpp>
+
+#include <direct_bt/DBGattServer.hpp>
+
+extern "C" {
+    #include <unistd.h>
+}
+
+using namespace direct_bt;
+
+/**
+ * DBGattServer compact binary image round trip, see DBGattServer::toBinary() and DBGattServer::fromBinary().
+ */
+
+static DBGattServerRef createGattServer(const int service_count, const int char_count) {
+    jau::darray<DBGattServiceRef> services;
+    for(int i=0; i<service_count; ++i) {
+        jau::darray<DBGattCharRef> chars;
+        for(int j=0; j<char_count; ++j) {
+            jau::POctets value(64, 2, jau::endian::little);
+            value.put_uint16_nc(0, static_cast<uint16_t>(i*char_count+j));
+            jau::POctets name(32, 0, jau::endian::little);
+            chars.push_back( std::make_shared<DBGattChar>( std::make_unique<const jau::uuid16_t>( static_cast<uint16_t>(0xB000 + j) ),
+                                 BTGattChar::PropertyBitVal::Read | BTGattChar::PropertyBitVal::WriteWithAck | BTGattChar::PropertyBitVal::Notify,
+                                 jau::make_darray( DBGattDesc::createClientCharConfig(),
+                                                   std::make_shared<DBGattDesc>( BTGattDesc::TYPE_USER_DESC, std::move(name), true /* variable_length */ ) ),
+                                 std::move(value), true /* variable_length */ ) );
+        }
+        if( 0 == i ) {
+            chars[0]->setPerConnectionValue(true);
+        }
+        services.push_back( std::make_shared<DBGattService>( 0 == i /* primary */,
+                                std::make_unique<const jau::uuid128_t>( "d0ca6bf3-3d50-4760-98e5-fc5883e93712" ),
+                                std::move(chars) ) );
+    }
+    return std::make_shared<DBGattServer>( 256, std::move(services) );
+}
+
+static void requireEqual(DBGattServer& a, DBGattServer& b) {
+    REQUIRE( a.getMaxAttMTU() == b.getMaxAttMTU() );
+    REQUIRE( a.getServices().size() == b.getServices().size() );
+    for(jau::nsize_t i=0; i<a.getServices().size(); ++i) {
+        DBGattServiceRef& sa = a.getServices()[i];
+        DBGattServiceRef& sb = b.getServices()[i];
+        REQUIRE( sa->isPrimary() == sb->isPrimary() );
+        REQUIRE( *sa->getType() == *sb->getType() );
+        REQUIRE( sa->getCharacteristics().size() == sb->getCharacteristics().size() );
+        for(jau::nsize_t j=0; j<sa->getCharacteristics().size(); ++j) {
+            DBGattCharRef& ca = sa->getCharacteristics()[j];
+            DBGattCharRef& cb = sb->getCharacteristics()[j];
+            REQUIRE( *ca->getValueType() == *cb->getValueType() );
+            REQUIRE( ca->getProperties() == cb->getProperties() );
+            REQUIRE( ca->hasVariableLength() == cb->hasVariableLength() );
+            REQUIRE( ca->hasPerConnectionValue() == cb->hasPerConnectionValue() );
+            REQUIRE( ca->getValue() == cb->getValue() );
+            REQUIRE( ca->getValue().capacity() == cb->getValue().capacity() );
+            REQUIRE( ca->getDescriptors().size() == cb->getDescriptors().size() );
+            REQUIRE( ( nullptr != cb->getClientCharConfig() ) );
+            REQUIRE( ( nullptr != cb->getUserDescription() ) );
+            for(jau::nsize_t k=0; k<ca->getDescriptors().size(); ++k) {
+                DBGattDescRef& da = ca->getDescriptors()[k];
+                DBGattDescRef& db = cb->getDescriptors()[k];
+                REQUIRE( *da->getType() == *db->getType() );
+                REQUIRE( da->hasVariableLength() == db->hasVariableLength() );
+                REQUIRE( da->getValue() == db->getValue() );
+                REQUIRE( da->getValue().capacity() == db->getValue().capacity() );
+            }
+        }
+    }
+}
+
+TEST_CASE( "DBGattServer Binary Test 01", "[datatype][dbgattserver]" ) {
+    DBGattServerRef db = createGattServer(4, 8);
+    const jau::POctets img = db->toBinary();
+
+    DBGattServerRef db2 = DBGattServer::fromBinary(img.get_ptr(), img.size());
+    REQUIRE( nullptr != db2 );
+    REQUIRE( DBGattServer::Mode::DB == db2->getMode() );
+    requireEqual(*db, *db2);
+
+    // distinct UUIDs are shared by all their attributes
+    REQUIRE( db2->getServices()[0]->getType().get() == db2->getServices()[1]->getType().get() );
+
+    // same handles
+    REQUIRE( db->setServicesHandles() == db2->setServicesHandles() );
+    REQUIRE( db->getAttributeEndHandle() == db2->getAttributeEndHandle() );
+
+    // invalid images
+    REQUIRE( nullptr == DBGattServer::fromBinary(img.get_ptr(), img.size()-1) );
+    REQUIRE( nullptr == DBGattServer::fromBinary(img.get_ptr(), 4) );
+    {
+        jau::POctets bad(img);
+        bad.put_uint32_nc(0, 0);
+        REQUIRE( nullptr == DBGattServer::fromBinary(bad.get_ptr(), bad.size()) );
+    }
+}
+
+TEST_CASE( "DBGattServer Binary File Test 02", "[datatype][dbgattserver]" ) {
+    DBGattServerRef db = createGattServer(16, 16);
+    const std::string fname = "test_dbgattserver_bin01.dbgs";
+    ::unlink(fname.c_str());
+
+    REQUIRE( true == db->write(fname, false /* overwrite */) );
+    REQUIRE( false == db->write(fname, false /* overwrite */) );
+    REQUIRE( true == db->write(fname, true /* overwrite */) );
+
+    DBGattServerRef db2 = DBGattServer::read(fname);
+    REQUIRE( nullptr != db2 );
+    requireEqual(*db, *db2);
+
+    ::unlink(fname.c_str());
+    REQUIRE( nullptr == DBGattServer::read(fname) );
+}
+
+TEST_CASE( "DBGattServer Binary Invalid Test 03", "[datatype][dbgattserver]" ) {
+    // Mode::NOP w/o services doesn't round-trip
+    {
+        DBGattServerRef db = std::make_shared<DBGattServer>( 256, jau::darray<DBGattServiceRef>() );
+        REQUIRE( DBGattServer::Mode::NOP == db->getMode() );
+        REQUIRE( 0 == db->toBinary().size() );
+        REQUIRE( false == db->write("test_dbgattserver_bin03.dbgs", true /* overwrite */) );
+    }
+    // value size exceeding uint16_t
+    {
+        jau::darray<DBGattCharRef> chars;
+        chars.push_back( std::make_shared<DBGattChar>( std::make_unique<const jau::uuid16_t>( 0xB000 ),
+                             BTGattChar::PropertyBitVal::Read,
+                             jau::darray<DBGattDescRef>(),
+                             jau::POctets(UINT16_MAX+1, UINT16_MAX+1, jau::endian::little), false /* variable_length */ ) );
+        jau::darray<DBGattServiceRef> services;
+        services.push_back( std::make_shared<DBGattService>( true /* primary */,
+                                std::make_unique<const jau::uuid128_t>( "d0ca6bf3-3d50-4760-98e5-fc5883e93712" ),
+                                std::move(chars) ) );
+        DBGattServerRef db = std::make_shared<DBGattServer>( 256, std::move(services) );
+        REQUIRE( DBGattServer::Mode::DB == db->getMode() );
+        REQUIRE( 0 == db->toBinary().size() );
+    }
+    // descriptor count exceeding uint8_t
+    {
+        jau::darray<DBGattDescRef> descs;
+        for(int k=0; k<=UINT8_MAX; ++k) {
+            descs.push_back( std::make_shared<DBGattDesc>( BTGattDesc::TYPE_USER_DESC, jau::POctets(4, 0, jau::endian::little), true /* variable_length */ ) );
+        }
+        jau::darray<DBGattCharRef> chars;
+        chars.push_back( std::make_shared<DBGattChar>( std::make_unique<const jau::uuid16_t>( 0xB000 ),
+                             BTGattChar::PropertyBitVal::Read,
+                             std::move(descs),
+                             jau::POctets(4, 4, jau::endian::little), false /* variable_length */ ) );
+        jau::darray<DBGattServiceRef> services;
+        services.push_back( std::make_shared<DBGattService>( true /* primary */,
+                                std::make_unique<const jau::uuid128_t>( "d0ca6bf3-3d50-4760-98e5-fc5883e93712" ),
+                                std::move(chars) ) );
+        DBGattServerRef db = std::make_shared<DBGattServer>( 256, std::move(services) );
+        REQUIRE( 0 == db->toBinary().size() );
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * Author: agent <agent@local>
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+#include <jau/test/catch2_ext.hpp>
+
+#include <direct_bt/L2CAPComm.hpp>
+#include <direct_bt/ATTPDUTypes.hpp>
+
+using namespace direct_bt;
+using namespace jau::fractions_i64_literals;
+
+/**
+ * L2CAPLoopback raw channel tests, exchanging hand-built ATT PDUs between both L2CAPClient ends,
+ * i.e. w/o BTGattHandler or DBGattServerHandler.
+ */
+
+static void exchangeATT(L2CAPLoopback& lb) {
+    uint8_t buffer[512];
+    {
+        const AttExchangeMTU req(AttExchangeMTU::ReqRespType::REQUEST, 512);
+        REQUIRE( (jau::snsize_t)req.pdu.size() == lb.first().write(req.pdu.get_ptr(), req.pdu.size()) );
+
+        const jau::snsize_t len = lb.second().read(buffer, sizeof(buffer), 1000 /* timeoutMS */);
+        REQUIRE( (jau::snsize_t)req.pdu.size() == len );
+        std::unique_ptr<const AttPDUMsg> pdu = AttPDUMsg::getSpecialized(buffer, len);
+        REQUIRE( AttPDUMsg::Opcode::EXCHANGE_MTU_REQ == pdu->getOpcode() );
+        REQUIRE( 512 == static_cast<const AttExchangeMTU*>(pdu.get())->getMTUSize() );
+    }
+    {
+        const AttReadReq req(0x0003);
+        REQUIRE( (jau::snsize_t)req.pdu.size() == lb.second().write(req.pdu.get_ptr(), req.pdu.size()) );
+
+        const jau::snsize_t len = lb.first().read(buffer, sizeof(buffer), 1000 /* timeoutMS */);
+        REQUIRE( (jau::snsize_t)req.pdu.size() == len );
+        std::unique_ptr<const AttPDUMsg> pdu = AttPDUMsg::getSpecialized(buffer, len);
+        REQUIRE( AttPDUMsg::Opcode::READ_REQ == pdu->getOpcode() );
+        REQUIRE( 0x0003 == static_cast<const AttReadReq*>(pdu.get())->getHandle() );
+    }
+}
+
+TEST_CASE( "L2CAP Loopback Test 01 Direct", "[l2cap][loopback]" ) {
+    L2CAPLoopback lb(100 /* mtu */);
+    std::cout << lb.toString() << std::endl;
+    REQUIRE( true == lb.isOpen() );
+    REQUIRE( 100 == lb.first().getTxMTU() );
+    REQUIRE( 100 == lb.second().getRxMTU() );
+
+    exchangeATT(lb);
+
+    // MTU exceeded
+    uint8_t big[101];
+    bzero(big, sizeof(big));
+    REQUIRE( L2CAPClient::number(L2CAPClient::RWExitCode::WRITE_ERROR) == lb.first().write(big, sizeof(big)) );
+    REQUIRE( 100 == lb.first().write(big, 100) );
+
+    // packet boundaries preserved, statistics counted
+    uint8_t buffer[200];
+    REQUIRE( 100 == lb.second().read(buffer, sizeof(buffer), 1000 /* timeoutMS */) );
+    REQUIRE( 2 == lb.second().getStats().reads );
+    REQUIRE( 1 == lb.first().getStats().write_errors );
+
+    // no data
+    REQUIRE( L2CAPClient::number(L2CAPClient::RWExitCode::POLL_TIMEOUT) == lb.second().read(buffer, sizeof(buffer), 10 /* timeoutMS */) );
+
+    // end of stream
+    lb.first().close();
+    REQUIRE( 0 == lb.second().read(buffer, sizeof(buffer), 1000 /* timeoutMS */) );
+}
+
+TEST_CASE( "L2CAP Loopback Test 02 Latency", "[l2cap][loopback]" ) {
+    L2CAPLoopback lb(L2CAPComm::LE_COC_MIN_MTU, 20_ms);
+    std::cout << lb.toString() << std::endl;
+    REQUIRE( true == lb.isOpen() );
+    REQUIRE( L2CAPComm::LE_COC_MIN_MTU == lb.first().getTxMTU() );
+
+    exchangeATT(lb);
+
+    // order preserved and delayed
+    uint8_t buffer[32];
+    const uint64_t t0 = jau::getCurrentMilliseconds();
+    for(uint8_t i=0; i<3; ++i) {
+        REQUIRE( 1 == lb.first().write(&i, 1) );
+    }
+    for(uint8_t i=0; i<3; ++i) {
+        REQUIRE( 1 == lb.second().read(buffer, sizeof(buffer), 1000 /* timeoutMS */) );
+        REQUIRE( i == buffer[0] );
+    }
+    const uint64_t td = jau::getCurrentMilliseconds() - t0;
+    std::cout << "latency " << td << " ms" << std::endl;
+    REQUIRE( 20 <= td );
+
+    // end of stream after pending packets
+    REQUIRE( 1 == lb.second().write(buffer, 1) );
+    lb.second().close();
+    REQUIRE( 1 == lb.first().read(buffer, sizeof(buffer), 1000 /* timeoutMS */) );
+    REQUIRE( 0 == lb.first().read(buffer, sizeof(buffer), 1000 /* timeoutMS */) );
+}
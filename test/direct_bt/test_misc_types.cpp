@@ -29,3 +29,33 @@ TEST_CASE( "HCIStatusCodeCategory std::error_code Test", "[HCIStatusCode][HCISta
     REQUIRE( 42 == ec_42.value() );
 
 }
+
+TEST_CASE( "L2CAPStats Aggregation Test", "[L2CAPStats]" ) {
+    L2CAPStats a;
+    a.reads = 2; a.bytes_read = 40;
+    a.writes = 3; a.bytes_written = 60; a.write_blocked_us = 100;
+    a.poll_timeouts = 1; a.read_errors = 1;
+
+    L2CAPStats b;
+    b.reads = 1; b.bytes_read = 20;
+    b.eagain_retries = 5; b.interrupts = 1; b.write_errors = 2; b.queue_full = 4;
+
+    L2CAPStats sum;
+    REQUIRE( 0 == sum.reads );
+    REQUIRE( 0 == sum.write_blocked_us );
+    sum += a;
+    sum += b;
+    std::cout << "sum: " << sum.toString() << std::endl;
+
+    REQUIRE(   3 == sum.reads );
+    REQUIRE(  60 == sum.bytes_read );
+    REQUIRE(   3 == sum.writes );
+    REQUIRE(  60 == sum.bytes_written );
+    REQUIRE(   5 == sum.eagain_retries );
+    REQUIRE(   1 == sum.poll_timeouts );
+    REQUIRE(   1 == sum.interrupts );
+    REQUIRE(   1 == sum.read_errors );
+    REQUIRE(   2 == sum.write_errors );
+    REQUIRE(   4 == sum.queue_full );
+    REQUIRE( 100 == sum.write_blocked_us );
+}
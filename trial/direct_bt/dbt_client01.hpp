@@ -497,6 +497,7 @@ class DBTClient01 : public DBTClientTest {
                                     }
                                 }
                             }
+                            serviceChar->ensureDescriptorsDiscovered();
                             jau::darray<BTGattDescRef> & charDescList = serviceChar->descriptorList;
                             for(size_t k=0; k<charDescList.size(); k++) {
                                 BTGattDesc & charDesc = *charDescList.at(k);